@@ -2,12 +2,42 @@
 //
 // Licensed public domain
 
+#if !defined(_WIN32) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
 #include <string.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#endif
+#if defined(__AVX2__)
+#define CGL_AVX2
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CGL_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define CGL_NEON
+#include <arm_neon.h>
+#endif
+#define GLFW_INCLUDE_GLEXT
 #include <GLFW/glfw3.h>
 #include "font.h"
+#include "font_atlas.h"
 #include "ConsoleGL.h"
 
 static const GLubyte sPalette[] = {
@@ -29,29 +59,550 @@ static const GLubyte sPalette[] = {
     0xff, 0xff, 0xff, // F Br. White
 };
 
-#define BLINK_SPEED (30)
+#define BLINK_PERIOD (0.5) // Seconds between blink toggles
+
+static GLubyte sColors[256 * 3]; // Runtime palette, RGB
+static GLboolean sColorsReady = GL_FALSE;
+static GLboolean sPaletteDirty = GL_FALSE;
+static int sColorMode = CGL_COLORS_16;
 
 static void (*sTickCallback)(void);
+static int sRenderer = CGL_RENDERER_FIXED;
+static int sBackend = CGL_BACKEND_OPENGL;
+static GLboolean sShutdown = GL_FALSE;
+static int sSwapInterval = 1;
+static int sFrameRate = 0;
+static GLboolean sIdle = GL_FALSE;
+static GLboolean sDamaged = GL_TRUE;
+static atomic_bool sWakeable;
+#if defined(_WIN32)
+static SRWLOCK sWakeLock = SRWLOCK_INIT;
+static CONDITION_VARIABLE sWake = CONDITION_VARIABLE_INIT; // Wakes a headless loop waiting for batches
+#else
+static pthread_mutex_t sWakeLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sWake;                               // Wakes a headless loop waiting for batches
+static pthread_once_t sWakeOnce = PTHREAD_ONCE_INIT;
+#endif
 static GLboolean sDirty = GL_TRUE;
+static int *sDirtyMin; // Per row, first dirty column
+static int *sDirtyMax; // Per row, one past the last dirty column
 static GLushort *sChars;
-static GLubyte *sTexture;
 static int sCharsWidth;
 static int sCharsHeight;
 static int sCharsArea;
 static int sCharsXPos = 0;
 static int sCharsYPos = 0;
+static int sRowOrigin = 0;   // Row of sChars shown at the top of the screen
+static int sScrollTop = 0;   // First row of the scroll region
+static int sScrollBottom = 0; // One past the last row of the scroll region
+typedef struct
+{
+    uint32_t codepoint;
+    uint32_t glyph;
+} CGLfontMapEntry;
+
+static const GLubyte *sFontBits = font_data; // Glyph rows packed MSB first, padded to whole bytes
+static const GLubyte *sFontAtlas = font_atlas; // 16x16 glyphs, one alpha byte per texel
+static const CGLfontMapEntry *sFontMap; // Sorted by codepoint, NULL when codepoints equal glyphs
+static int sFontMapCount;
+static GLubyte *sLoadedFont; // Holds sFontBits and sFontAtlas after CGLloadFont
+static CGLfontMapEntry *sLoadedMap;
+static int sGlyphCount = 256;
+static int sGlyphWidth = 8;
+static int sGlyphHeight = 8;
+static const GLubyte *sGlyphBits[256]; // Packed rows drawn for each glyph of a cell
+
+// Glyph cache, maps codepoints to glyphs 128-255 of the atlas
+#define CGL_CACHE_SLOTS (128)
+#define CGL_CACHE_TABLE (256) // Open addressing table, a power of two
+
+static GLboolean sGlyphCache = GL_FALSE;
+static uint32_t sCacheKeys[CGL_CACHE_TABLE]; // Codepoint + 1, 0 when empty
+static GLubyte sCacheEntries[CGL_CACHE_TABLE]; // Slot of each key
+static uint32_t sSlotCodepoints[CGL_CACHE_SLOTS];
+static uint32_t sSlotTicks[CGL_CACHE_SLOTS]; // Tick of the last lookup
+static uint32_t sSlotVisible[CGL_CACHE_SLOTS / 32];
+static uint32_t sSlotPending[CGL_CACHE_SLOTS / 32]; // Slots waiting for an atlas upload
+static GLboolean sSlotVisibleValid;
+static GLboolean sGlyphsPending;
+static int sCacheUsed;
+static uint32_t sCacheTick = 1;
+
+// Unicode codepoints of the CP437 glyphs in font.h
+static const uint16_t sCP437[256] = {
+    0x0000, 0x263a, 0x263b, 0x2665, 0x2666, 0x2663, 0x2660, 0x2022, 0x25d8, 0x25cb, 0x25d9, 0x2642, 0x2640, 0x266a, 0x266b, 0x263c,
+    0x25ba, 0x25c4, 0x2195, 0x203c, 0x00b6, 0x00a7, 0x25ac, 0x21a8, 0x2191, 0x2193, 0x2192, 0x2190, 0x221f, 0x2194, 0x25b2, 0x25bc,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x2302,
+    0x00c7, 0x00fc, 0x00e9, 0x00e2, 0x00e4, 0x00e0, 0x00e5, 0x00e7, 0x00ea, 0x00eb, 0x00e8, 0x00ef, 0x00ee, 0x00ec, 0x00c4, 0x00c5,
+    0x00c9, 0x00e6, 0x00c6, 0x00f4, 0x00f6, 0x00f2, 0x00fb, 0x00f9, 0x00ff, 0x00d6, 0x00dc, 0x00a2, 0x00a3, 0x00a5, 0x20a7, 0x0192,
+    0x00e1, 0x00ed, 0x00f3, 0x00fa, 0x00f1, 0x00d1, 0x00aa, 0x00ba, 0x00bf, 0x2310, 0x00ac, 0x00bd, 0x00bc, 0x00a1, 0x00ab, 0x00bb,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556, 0x2555, 0x2563, 0x2551, 0x2557, 0x255d, 0x255c, 0x255b, 0x2510,
+    0x2514, 0x2534, 0x252c, 0x251c, 0x2500, 0x253c, 0x255e, 0x255f, 0x255a, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256c, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256b, 0x256a, 0x2518, 0x250c, 0x2588, 0x2584, 0x258c, 0x2590, 0x2580,
+    0x03b1, 0x00df, 0x0393, 0x03c0, 0x03a3, 0x03c3, 0x00b5, 0x03c4, 0x03a6, 0x0398, 0x03a9, 0x03b4, 0x221e, 0x03c6, 0x03b5, 0x2229,
+    0x2261, 0x00b1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00f7, 0x2248, 0x00b0, 0x2219, 0x00b7, 0x221a, 0x207f, 0x00b2, 0x25a0, 0x00a0,
+};
 static GLshort sLastAttrib = (128 + 31) << 8;
+static GLushort *sCellColors; // Per cell, fg | bg << 8 palette indices with CGL_COLORS_256
+static GLushort sLastColors = 15 | (1 << 8);
 static char* sPrintFBuffer;
 
+static GLuint sFontTexture;
+
+static GLuint sIndexHandle;
+static GLuint sVertexHandle;
+static GLuint sTextureCoordHandle;
+static GLuint sFgColorHandle;
+static GLuint sBgColorHandle;
 static GLuint *sIndexBuffer;
 static GLfloat *sVertexBuffer;
 static GLshort *sTextureCoordBuffer;
 static GLubyte *sFgColorBuffer;
 static GLubyte *sBgColorBuffer;
+static int *sSlotDirtyMin; // Per slot of every console, cells changed by the current update
+static int *sSlotDirtyMax;
+static GLboolean *sSlotBuilt; // Per slot, the tile and its vertices were built by the current update
+
+// Fixed renderer VBOs, in the order vertices, texture coordinates, fg and bg colors
+#define CGL_FIXED_BUFFERS (4)
+static GLuint* const sBufferHandles[CGL_FIXED_BUFFERS] = {&sVertexHandle, &sTextureCoordHandle, &sFgColorHandle, &sBgColorHandle};
+static const GLsizeiptr sBufferCellSizes[CGL_FIXED_BUFFERS] = {4 * 3 * sizeof(GLfloat), 4 * 2 * sizeof(GLshort), 4 * 4, 4 * 4};
+
+// Streaming keeps a segment of every VBO per frame in flight, each frame with changes writes the next one
+#define CGL_STREAM_SEGMENTS (3)
+enum
+{
+    CGL_STREAM_SUBDATA,    // A single copy updated with glBufferSubData
+    CGL_STREAM_MAP_RANGE,  // Segments written through unsynchronized glMapBufferRange
+    CGL_STREAM_PERSISTENT, // Segments written through a persistent coherent mapping
+};
+
+static int sStreamMode = CGL_STREAM_SUBDATA;
+static int sStreamSegment;                          // Segment the draws read
+static GLsync sStreamFences[CGL_STREAM_SEGMENTS];   // Per segment, signaled when the last frame that drew it is done
+static GLubyte *sStreamMaps[CGL_FIXED_BUFFERS];     // Per VBO, mapping of all segments
+static int *sStreamDirtyMin;                        // Per segment and slot, cells changed since the segment was written
+static int *sStreamDirtyMax;
+static GLboolean *sStreamBuilt;                     // Per segment and slot, the vertices changed too
+
+// Cells the fixed renderer regenerates, queued by the update of every console and run by the worker pool
+typedef struct
+{
+    const GLushort* chars;  // First cell in sChars of its console
+    const GLushort* colors; // Its colors, NULL without a color plane
+    int dst;                // First cell in the client side buffers
+    int count;
+    int x;                  // Pixel position of the first quad, x < 0 keeps the vertices
+    int y;
+} CGLrebuildJob;
+
+static CGLrebuildJob *sRebuildJobs;
+static int sRebuildJobCount;
+static int sRebuildJobCapacity;
+static int sRebuildCells;
+static uint32_t sFgPixels[2][256]; // Per blink state, RGBA of every palette entry with the glyph alpha
+static uint32_t sBgPixels[256];
+
+// Worker pool, the main thread runs a share of every task too
+#define CGL_POOL_MAX_WORKERS (63)
+#define CGL_POOL_MIN_CELLS (4096) // Smaller rebuilds run on the main thread alone
+#define CGL_POOL_CHUNK_JOBS (16)  // Rebuild jobs taken at a time, about one tile
+
+static int sThreadsHint;
+static int sWorkerCount;
+static void (*sPoolTask)(int _first, int _last);
+static int sPoolItems;
+static int sPoolChunk;
+static atomic_int sPoolNext;     // Next chunk of the task to take
+static int sPoolBusy;            // Workers still running the task
+static unsigned sPoolGeneration; // Counts the tasks
+static GLboolean sPoolExit;
+#if defined(_WIN32)
+static HANDLE sWorkers[CGL_POOL_MAX_WORKERS];
+static CRITICAL_SECTION sPoolLock;
+static CONDITION_VARIABLE sPoolStart;
+static CONDITION_VARIABLE sPoolDone;
+#else
+static pthread_t sWorkers[CGL_POOL_MAX_WORKERS];
+static pthread_mutex_t sPoolLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sPoolStart = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t sPoolDone = PTHREAD_COND_INITIALIZER;
+#endif
+
+static GLuint sGridTexture;
+static GLuint sColorTexture;
+static GLuint sPaletteTexture;
+static GLuint sQuadHandle;
+static GLuint sProgram;
+static GLint sBlinkLocation;
+static GLint sWideLocation;
+
+static uint32_t *sFramebuffer;
+static int sFramebufferWidth;
+static int sFramebufferHeight;
+static int sFramebufferOrigin; // sRowOrigin the framebuffer was rendered with
+static GLfloat *sQuadBuffer; // Per console, two triangles for the shader renderer
+static int sTextureWidth;
+static int sTextureHeight;
+
+// Terminal backend, screen cells hold the cell in the low and its fg | bg << 8 colors in the high 16 bits
+#define CGL_TERM_UNKNOWN (0xffffffffu) // A shadow cell the terminal may show anything in
+#define CGL_TERM_CELL_BYTES (48)       // Worst case output for one changed cell
+
+static uint32_t *sTermScreen;   // Every console composed in screen order
+static uint32_t *sTermShadow;   // What the terminal shows
+static int *sTermDirtyMin;      // Per screen row, span of sTermScreen composed since the last frame
+static int *sTermDirtyMax;
+static char *sTermBuffer;       // One frame of output
+static size_t sTermLength;
+static int sTermX;              // Cursor position, -1 when unknown
+static int sTermY;
+static int sTermFg;             // Current SGR state, -1 when unknown
+static int sTermBg;
+static int sTermBlink;
+static uint32_t sTermCodepoints[256]; // Codepoint written for each glyph
+
+// Batches submitted by producer threads, newest first
+struct CGLbatch
+{
+    struct CGLbatch* next;
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+};
+
+typedef struct
+{
+    int col;
+    int row;
+    int width;
+    int height;
+} CGLbatchRecord;
+
+static _Atomic(CGLbatch*) sPendingBatches;
+
+static double sNextBlink;
+
+// CGLfeed parser state
+enum
+{
+    CGL_FEED_GROUND,
+    CGL_FEED_ESCAPE,
+    CGL_FEED_CSI,
+    CGL_FEED_OSC,
+    CGL_FEED_OSC_ESCAPE,
+    CGL_FEED_CHARSET
+};
 
-static int sBlinkTimer = BLINK_SPEED;
+#define CGL_FEED_MAX_PARAMS (16)
+
+static int sFeedState = CGL_FEED_GROUND;
+static int sFeedParams[CGL_FEED_MAX_PARAMS];
+static int sFeedParamCount;
+static GLboolean sFeedPrivate;
+static GLboolean sFeedWrapPending;
+static int sFeedFg = 7;
+static int sFeedBg = 0;
+static GLboolean sFeedBold;
+static GLboolean sFeedBlink;
+static GLboolean sFeedReverse;
+static int sFeedSavedX;
+static int sFeedSavedY;
+static int *sRowBlinks; // Per row of sChars, number of blinking cells
+static int sBlinkCount;
 static GLboolean sBlinkState = GL_FALSE;
 
+// Placement of the current console in the window and in the shared render buffers
+static int sPaneCol;   // Position in cells of the main console, for a layer of its console
+static int sPaneRow;
+static int sPaneIndex; // Draw order, the main console is 0
+static int sCellBase;  // First cell of its tile slots in the fixed renderer buffers
+static int sTextureRow; // First row in the shader renderer grid texture
+static int sVertexOrigin = -1; // sRowOrigin the vertices were built with
+
+// Layers composited into the current console, the renderers show sShown instead of sChars while it has any
+static CGLContext* sLayers;    // In stacking order, bottom first
+static GLushort* sShown;
+static GLushort* sShownColors;
+static int sComposeOrigin;     // sRowOrigin the cells under the layers were composited with, of a layer its own
+
+// Part of the console shown in the window, smaller than the grid for the main console with CGL_HINT_VIEW_*
+static int sViewCol;
+static int sViewRow;
+static int sViewColumns;
+static int sViewRows;
+
+// The fixed renderer keeps the tiles around the view in a pool of slots, tile (x, y) goes in
+// slot (x % sSlotColumns, y % sSlotRows) with rows counted on from the first tile in view
+#define CGL_TILE_COLUMNS (32)
+#define CGL_TILE_ROWS (16)
+#define CGL_TILE_CELLS (CGL_TILE_COLUMNS * CGL_TILE_ROWS)
+
+static int sSlotColumns;
+static int sSlotRows;
+static int *sSlotTiles; // Per slot, the tile it holds or -1
+static int *sTileSlots; // Per tile, the slot holding it or -1
+
+// State of one console, held in the statics above while it is current
+#define CGL_CONTEXT_STATE(X) \
+    X(int*, DirtyMin) \
+    X(int*, DirtyMax) \
+    X(GLushort*, Chars) \
+    X(int, CharsWidth) \
+    X(int, CharsHeight) \
+    X(int, CharsArea) \
+    X(int, CharsXPos) \
+    X(int, CharsYPos) \
+    X(int, RowOrigin) \
+    X(int, ScrollTop) \
+    X(int, ScrollBottom) \
+    X(GLshort, LastAttrib) \
+    X(GLushort*, CellColors) \
+    X(GLushort, LastColors) \
+    X(char*, PrintFBuffer) \
+    X(int, FramebufferOrigin) \
+    X(int, FeedState) \
+    X(int, FeedParamCount) \
+    X(GLboolean, FeedPrivate) \
+    X(GLboolean, FeedWrapPending) \
+    X(int, FeedFg) \
+    X(int, FeedBg) \
+    X(GLboolean, FeedBold) \
+    X(GLboolean, FeedBlink) \
+    X(GLboolean, FeedReverse) \
+    X(int, FeedSavedX) \
+    X(int, FeedSavedY) \
+    X(int*, RowBlinks) \
+    X(int, BlinkCount) \
+    X(int, PaneCol) \
+    X(int, PaneRow) \
+    X(int, PaneIndex) \
+    X(int, CellBase) \
+    X(int, TextureRow) \
+    X(int, VertexOrigin) \
+    X(int, ViewCol) \
+    X(int, ViewRow) \
+    X(int, ViewColumns) \
+    X(int, ViewRows) \
+    X(int, SlotColumns) \
+    X(int, SlotRows) \
+    X(int*, SlotTiles) \
+    X(int*, TileSlots) \
+    X(CGLContext*, Layers) \
+    X(GLushort*, Shown) \
+    X(GLushort*, ShownColors) \
+    X(int, ComposeOrigin)
+
+struct CGLContext
+{
+    struct CGLContext* next;
+    struct CGLContext* parent; // Console a layer is composited into, NULL for consoles
+    GLushort transparent;      // Cell of a layer that shows what is under it
+    GLboolean visible;
+    int FeedParams[CGL_FEED_MAX_PARAMS];
+#define CGL_CONTEXT_DECLARE(_type, _name) _type _name;
+    CGL_CONTEXT_STATE(CGL_CONTEXT_DECLARE)
+#undef CGL_CONTEXT_DECLARE
+};
+
+static CGLContext sMainContext;
+static CGLContext* sContexts = &sMainContext; // In draw order
+static CGLContext* sContext = &sMainContext;  // Held in the statics
+static GLboolean sLayoutDirty = GL_TRUE;
+static int sPaneCount; // Consoles placed by the last layout
+static int sCellCount;
+static int sMainCells; // Cells of the main console at the start of the fixed renderer buffers
+static int sViewColumnsHint;
+static int sViewRowsHint;
+
+// Session recording, see CGLrecord for the format
+enum
+{
+    CGL_RECORD_FRAME_END,
+    CGL_RECORD_ORIGIN, // Row of sChars shown at the top of the screen
+    CGL_RECORD_CELLS,  // Span tokens for a row of sChars
+    CGL_RECORD_COLORS  // Span tokens for a row of sCellColors
+};
+
+enum
+{
+    CGL_RECORD_SKIP, // Cells left as they are
+    CGL_RECORD_FILL, // Cells set to one value
+    CGL_RECORD_XOR,  // Cells xored with one value each
+    CGL_RECORD_END
+};
+
+#define CGL_RECORD_VERSION (1)
+#define CGL_RECORD_MIN_FILL (4) // Shorter runs of equal cells are cheaper as xor values
+
+static FILE* sRecordFile;
+static GLushort* sRecordShadow; // sChars as of the last recorded frame
+static GLushort* sRecordColors; // sCellColors as of the last recorded frame
+static GLubyte* sRecordBuffer;  // One encoded frame
+static int* sRecordMin;         // Per row, first column a renderer consumed since the last recorded frame
+static int* sRecordMax;         // Per row, one past the last such column
+static int sRecordOrigin;
+static GLboolean sRecordFull;   // Compare every cell on the next frame
+static double sRecordTime;      // Time of the last recorded frame
+
+static const unsigned char* sPlayData;
+static size_t sPlaySize;
+static size_t sPlayPos;
+static GLboolean sPlayFast;
+static double sPlayStart;
+static double sPlayTime; // Recorded time of the last played frame
+static double sPlayNext; // When the next frame is due
+
+// Frame statistics over the last CGL_STATS_FRAMES frames, see CGLgetStats
+#define CGL_STATS_FRAMES (256)
+#define CGL_TIMER_QUERIES (4) // GPU timings in flight
+
+typedef struct
+{
+    double time;                       // Tick to swap
+    double phases[CGL_PHASE_COUNT];
+    double gpu;                        // Draw time on the GPU, < 0 until known
+    long long cellsChanged;
+    long long cellsRebuilt;
+    long long bytesUploaded;
+} CGLframeStats;
+
+static const char* const sPhaseNames[CGL_PHASE_COUNT] = {"tick", "blink", "rebuild", "upload", "draw", "swap"};
+static CGLframeStats sFrames[CGL_STATS_FRAMES];
+static CGLframeStats sFrame; // The frame being measured
+static int sFrameCount;      // Frames measured since CGLmain
+static double sFrameStart;
+static int sPhase = -1;      // Phase being measured, -1 between frames
+static double sPhaseStart;
+static GLuint sTimerQueries[CGL_TIMER_QUERIES];
+static int sTimerFrames[CGL_TIMER_QUERIES]; // Per query, the frame it times or -1 when free
+static double sTimerStarts[CGL_TIMER_QUERIES];
+static int sTimerNext;
+static GLboolean sTimerActive;
+
+// Chrome trace event output, see CGLtrace
+static FILE* sTraceFile;
+static double sTraceStart;
+static GLboolean sTraceFirst;
+
+// Input events queued by the window callbacks, see CGLpollEvent
+#define CGL_EVENT_QUEUE (256)
+
+static const char* const sEventNames[] = {"", "key", "char", "mouse move", "mouse button", "scroll", "resize"};
+static CGLevent sEvents[CGL_EVENT_QUEUE];
+static int sEventFirst;        // Oldest queued event
+static int sEventCount;
+static double sEventBase;      // Start of CGLmain, event times count from it
+static int sEventColumns;      // Cells across the window
+static int sEventRows;
+static double sTakenTimes[CGL_EVENT_QUEUE]; // Events taken this frame, not yet presented
+static int sTakenTypes[CGL_EVENT_QUEUE];
+static int sTakenCount;
+static double sLatencies[CGL_STATS_FRAMES]; // Input to present of the last events taken
+static int sLatencyCount;
+static int sInputDelay = 0;    // Milliseconds between a swap and reading input
+
+// GL 2.0+ entry points used by the shader renderer, resolved at runtime
+#define CGL_GL_FUNCTIONS(X) \
+    X(PFNGLACTIVETEXTUREPROC, ActiveTexture) \
+    X(PFNGLCREATESHADERPROC, CreateShader) \
+    X(PFNGLSHADERSOURCEPROC, ShaderSource) \
+    X(PFNGLCOMPILESHADERPROC, CompileShader) \
+    X(PFNGLGETSHADERIVPROC, GetShaderiv) \
+    X(PFNGLDELETESHADERPROC, DeleteShader) \
+    X(PFNGLCREATEPROGRAMPROC, CreateProgram) \
+    X(PFNGLDELETEPROGRAMPROC, DeleteProgram) \
+    X(PFNGLATTACHSHADERPROC, AttachShader) \
+    X(PFNGLBINDATTRIBLOCATIONPROC, BindAttribLocation) \
+    X(PFNGLLINKPROGRAMPROC, LinkProgram) \
+    X(PFNGLGETPROGRAMIVPROC, GetProgramiv) \
+    X(PFNGLUSEPROGRAMPROC, UseProgram) \
+    X(PFNGLGETUNIFORMLOCATIONPROC, GetUniformLocation) \
+    X(PFNGLUNIFORM1IPROC, Uniform1i) \
+    X(PFNGLUNIFORM2IPROC, Uniform2i) \
+    X(PFNGLVERTEXATTRIBPOINTERPROC, VertexAttribPointer) \
+    X(PFNGLENABLEVERTEXATTRIBARRAYPROC, EnableVertexAttribArray) \
+    X(PFNGLDISABLEVERTEXATTRIBARRAYPROC, DisableVertexAttribArray)
+
+// GL 3.0+ entry points used to stream the fixed renderer buffers, each resolved when available
+#define CGL_GL_STREAM_FUNCTIONS(X) \
+    X(PFNGLMAPBUFFERRANGEPROC, MapBufferRange) \
+    X(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, FlushMappedBufferRange) \
+    X(PFNGLFENCESYNCPROC, FenceSync) \
+    X(PFNGLCLIENTWAITSYNCPROC, ClientWaitSync) \
+    X(PFNGLDELETESYNCPROC, DeleteSync) \
+    X(PFNGLBUFFERSTORAGEPROC, BufferStorage)
+
+// GL 3.3 entry points used to time the draws on the GPU, resolved when available
+#define CGL_GL_TIMER_FUNCTIONS(X) \
+    X(PFNGLGENQUERIESPROC, GenQueries) \
+    X(PFNGLDELETEQUERIESPROC, DeleteQueries) \
+    X(PFNGLBEGINQUERYPROC, BeginQuery) \
+    X(PFNGLENDQUERYPROC, EndQuery) \
+    X(PFNGLGETQUERYOBJECTIVPROC, GetQueryObjectiv) \
+    X(PFNGLGETQUERYOBJECTUI64VPROC, GetQueryObjectui64v)
+
+#define CGL_GL_DECLARE(_type, _name) _type _name;
+static struct
+{
+    CGL_GL_FUNCTIONS(CGL_GL_DECLARE)
+    CGL_GL_STREAM_FUNCTIONS(CGL_GL_DECLARE)
+    CGL_GL_TIMER_FUNCTIONS(CGL_GL_DECLARE)
+} sGL;
+#undef CGL_GL_DECLARE
+
+static const char* sVertexShader =
+    "#version 130\n"
+    "in vec2 aPosition;\n"
+    "in vec2 aCell;\n"
+    "in vec4 aPane;\n"
+    "out vec2 vCell;\n"
+    "flat out ivec4 vPane;\n"
+    "void main()\n"
+    "{\n"
+    "    vCell = aCell;\n"
+    "    vPane = ivec4(aPane);\n"
+    "    gl_Position = vec4(aPosition, 0.0, 1.0);\n"
+    "}\n";
+
+static const char* sFragmentShader =
+    "#version 130\n"
+    "uniform usampler2D uGrid;\n"
+    "uniform usampler2D uColors;\n"
+    "uniform sampler2D uFont;\n"
+    "uniform sampler2D uPalette;\n"
+    "uniform ivec2 uGlyphSize;\n"
+    "uniform int uBlink;\n"
+    "uniform int uWide;\n"
+    "in vec2 vCell;\n"
+    "flat in ivec4 vPane;\n" // Texture row, rows, row origin and columns of the console
+    "void main()\n"
+    "{\n"
+    "    ivec2 cell = min(ivec2(vCell), vPane.wy - 1);\n"
+    "    cell.y = (cell.y + vPane.z) % vPane.y + vPane.x;\n"
+    "    uint d = texelFetch(uGrid, cell, 0).r;\n"
+    "    int glyph = int(d & 255u);\n"
+    "    int fg = int((d >> 8) & 15u);\n"
+    "    int bg = int((d >> 12) & 7u);\n"
+    "    if (uWide != 0)\n"
+    "    {\n"
+    "        uint c = texelFetch(uColors, cell, 0).r;\n"
+    "        fg = int(c & 255u);\n"
+    "        bg = int(c >> 8);\n"
+    "    }\n"
+    "    if ((d & 32768u) != 0u && uBlink != 0) fg = bg;\n"
+    "    ivec2 texel = ivec2(glyph % 16, glyph / 16) * uGlyphSize + ivec2(fract(vCell) * vec2(uGlyphSize));\n"
+    "    float alpha = texelFetch(uFont, texel, 0).a;\n"
+    "    vec3 fgColor = texelFetch(uPalette, ivec2(fg, 0), 0).rgb;\n"
+    "    vec3 bgColor = texelFetch(uPalette, ivec2(bg, 0), 0).rgb;\n"
+    "    gl_FragColor = vec4(mix(bgColor, fgColor, alpha), 1.0);\n"
+    "}\n";
+
 const char* _CGLerror(const char* _msg)
 {
     glfwTerminate();
@@ -59,409 +610,5354 @@ const char* _CGLerror(const char* _msg)
 }
 
 /**
- *  Opens a window
+ * Returns seconds from a monotonic clock
  */
-const char* CGLmain(const char* _windowTitle, int _columns, int _rows, void (*_callback)(void))
+static double _CGLtime()
 {
-    sCharsWidth = _columns;
-    sCharsHeight = _rows;
-    sCharsArea = _columns * _rows;
-    
-    sPrintFBuffer = malloc(sizeof(char) * sCharsArea);
-    if (!sPrintFBuffer) return _CGLerror("ERROR: Cannot allocate printf buffer.");
-    
-    sTickCallback = _callback;
-    GLFWwindow* window;
-    
-    /* Initialize the library */
-    if (!glfwInit()) return _CGLerror("ERROR: glfwInit failed.");
-    
-    /* Create a windowed mode window and its OpenGL context */
-    glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
-    window = glfwCreateWindow(_columns * 8 * 2, _rows * 8 * 2, _windowTitle, NULL, NULL);
-    if (!window) return _CGLerror("ERROR: glfwCreateWindow failed.");
-    
-    // Allocate screen buffer
-    sChars = malloc(_columns * _rows * sizeof(unsigned short));
-    if (!sChars) return _CGLerror("ERROR: Cannot allocate screen buffer.");
-    memset(sChars, 0, sCharsArea * sizeof(GLushort));
-    
-    // Allocate texture
-    sTexture = malloc(128 * 128);
-    if (!sTexture) return _CGLerror("ERROR: Cannot allocate texture.");
-    memset(sTexture, 0, 128 * 128);
-    // Copy font to texture
-    {
-        for (int x = 0; x < 16; x++)
-        {
-            for (int y = 0; y < 16; y++)
-            {
-                for (int yy = 0; yy < 8; yy++)
-                {
-                    GLubyte row = font_data[((y * 16 + x) * 8) + yy];
-                    for (int xx = 0; xx < 8; xx++)
-                    {
-                        GLubyte alpha = ((row >> (7 - xx)) & 1) * 255;
-                        sTexture[((y * 8 + yy) * 128) + (x * 8 + xx)] = alpha;
-                    }
-                }
-            }
-        }
-    }
-    
-    /* Make the window's context current */
-    glfwMakeContextCurrent(window);
-    glfwSwapInterval(1);
-    
-    glMatrixMode(GL_TEXTURE);
-    glLoadIdentity();
-    glScalef(1.0f / 128.0f, 1.0f / 128.0f, 1.0f);
-    
-    glMatrixMode(GL_PROJECTION);
-    glLoadIdentity();
-    glOrtho(0.0f, _columns * 8.0f, _rows * 8.0f, 0.0f, 0.0f, 1.0f);
-    
-    glMatrixMode(GL_MODELVIEW);
-    glLoadIdentity();
-    
-    // Create textures
-    GLuint texId;
-    glGenTextures(1, &texId);
-    glBindTexture(GL_TEXTURE_2D, texId);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, 128, 128, 0, GL_ALPHA, GL_UNSIGNED_BYTE, sTexture);
-    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-    glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-    
-    // Build VBOs
-    size_t size;
+#if defined(_WIN32)
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
 
-    // Create Index Buffer
-    GLuint indexHandle;
-    size = _columns * _rows * 6 * sizeof(GLuint);
-    sIndexBuffer = malloc(size);
-    if (!sIndexBuffer) return _CGLerror("ERROR: Cannot allocate index vbo.");
-    int len  = _columns * _rows * 6;
-    for (int i = 0, v = 0; i < len; i += 6, v += 4)
+/**
+ * Sleeps the calling thread
+ */
+static void _CGLsleep(double _seconds)
+{
+    if (_seconds <= 0.0) return;
+#if defined(_WIN32)
+    Sleep((DWORD)(_seconds * 1000.0));
+#else
+    struct timespec ts;
+    ts.tv_sec = (time_t)_seconds;
+    ts.tv_nsec = (long)((_seconds - ts.tv_sec) * 1e9);
+    nanosleep(&ts, NULL);
+#endif
+}
+
+#if !defined(_WIN32)
+/**
+ * Sets sWake to time out on the monotonic clock, like every other deadline
+ */
+static void _CGLinitWake()
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&sWake, &attr);
+    pthread_condattr_destroy(&attr);
+}
+#endif
+
+/**
+ * Sleeps the calling thread until a batch is submitted or _seconds passed
+ */
+static void _CGLwaitBatches(double _seconds)
+{
+    if (_seconds <= 0.0) return;
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&sWakeLock);
+    if (!atomic_load(&sPendingBatches)) SleepConditionVariableSRW(&sWake, &sWakeLock, (DWORD)(_seconds * 1000.0), 0);
+    ReleaseSRWLockExclusive(&sWakeLock);
+#else
+    pthread_once(&sWakeOnce, _CGLinitWake);
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    const double nanoseconds = ts.tv_nsec + (_seconds - (time_t)_seconds) * 1e9;
+    ts.tv_sec += (time_t)_seconds + (time_t)(nanoseconds * 1e-9);
+    ts.tv_nsec = (long)nanoseconds % 1000000000L;
+    pthread_mutex_lock(&sWakeLock);
+    while (!atomic_load(&sPendingBatches))
     {
-        sIndexBuffer[i + 0] = v + 0;
-        sIndexBuffer[i + 1] = v + 1;
-        sIndexBuffer[i + 2] = v + 2;
-        sIndexBuffer[i + 3] = v + 2;
-        sIndexBuffer[i + 4] = v + 3;
-        sIndexBuffer[i + 5] = v + 1;
+        if (pthread_cond_timedwait(&sWake, &sWakeLock, &ts)) break;
     }
-    glGenBuffers(1, &indexHandle);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexHandle);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, sIndexBuffer, GL_STATIC_DRAW);
+    pthread_mutex_unlock(&sWakeLock);
+#endif
+}
+
+/**
+ * Returns the number of cores
+ */
+static int _CGLcoreCount()
+{
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int)info.dwNumberOfProcessors;
+#else
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+#endif
+}
 
-    // Create Vertex Buffer
-    GLuint vertexHandle;
-    size = _columns * _rows * 4 * 3 * sizeof(GLfloat);
-    sVertexBuffer = malloc(size);
-    memset(sVertexBuffer, 0, size);
-    if (!sVertexBuffer) return _CGLerror("ERROR: Cannot allocate vertex vbo.");
-    for (int y = 0; y < _rows; y++)
+/**
+ * Takes chunks of the current pool task until none are left
+ */
+static void _CGLpoolWork()
+{
+    for (;;)
     {
-        for (int x = 0; x < _columns; x++)
-        {
-            static const float offsets[12] = {0,0,0,8,0,0,0,8,0,8,8,0};
-            const GLuint addr = (y * _columns + x) * (4 * 3);
-            int i = 0;
-            while(i < 12)
-            {
-                sVertexBuffer[addr + i] = (x * 8) + offsets[i]; i++;
-                sVertexBuffer[addr + i] = (y * 8) + offsets[i]; i++;
-                i++;
-            }
-        }
+        const int first = atomic_fetch_add(&sPoolNext, 1) * sPoolChunk;
+        if (first >= sPoolItems) return;
+        sPoolTask(first, first + sPoolChunk < sPoolItems ? first + sPoolChunk : sPoolItems);
     }
-    
-    glGenBuffers(1, &vertexHandle);
-    glBindBuffer(GL_ARRAY_BUFFER, vertexHandle);
-    glBufferData(GL_ARRAY_BUFFER, size, sVertexBuffer, GL_STATIC_DRAW);
-    
-    // Create Texture Coord Buffer
-    GLuint textureCoordHandle;
-    size = _columns * _rows * 4 * 2 * sizeof(GLshort);
-    sTextureCoordBuffer = malloc(size);
-    if (!sTextureCoordBuffer) return _CGLerror("ERROR: Cannot allocate texture coordinate vbo.");
-    memset(sTextureCoordBuffer, 0, size);
-    glGenBuffers(1, &textureCoordHandle);
-    glBindBuffer(GL_ARRAY_BUFFER, textureCoordHandle);
-    glBufferData(GL_ARRAY_BUFFER, size, sTextureCoordBuffer, GL_DYNAMIC_DRAW);
-    
-    // Create Foreground Color Buffer
-    GLuint fgColorHandle;
-    size = _columns * _rows * 4 * 4 * sizeof(GLubyte);
-    sFgColorBuffer = malloc(size);
-    if (!sFgColorBuffer) return _CGLerror("ERROR: Cannot allocate foreground color vbo.");
-    memset(sFgColorBuffer, 255, size);
-    glGenBuffers(1, &fgColorHandle);
-    glBindBuffer(GL_ARRAY_BUFFER, fgColorHandle);
-    glBufferData(GL_ARRAY_BUFFER, size, sFgColorBuffer, GL_DYNAMIC_DRAW);
-    
-    // Create Background Color Buffer
-    GLuint bgColorHandle;
-    size = _columns * _rows * 4 * 4 * sizeof(GLubyte);
-    sBgColorBuffer = malloc(size);
-    if (!sBgColorBuffer) return _CGLerror("ERROR: Cannot allocate background color vbo.");
-    memset(sBgColorBuffer, 0, size);
-    glGenBuffers(1, &bgColorHandle);
-    glBindBuffer(GL_ARRAY_BUFFER, bgColorHandle);
-    glBufferData(GL_ARRAY_BUFFER, size, sBgColorBuffer, GL_DYNAMIC_DRAW);
-    
-    CGLprint("Hello World");
-    
-    /* Loop until the user closes the window */
-    while (!glfwWindowShouldClose(window))
-    {
-        /* Render here */
-        sTickCallback();
-        
-        sBlinkTimer--;
-        if (sBlinkTimer < 0)
-        {
-            sBlinkState = !sBlinkState;
-            sBlinkTimer = BLINK_SPEED;
-            if (!sDirty)
-            {
-                for (int y = 0; y < _rows; y++)
-                {
-                    for (int x = 0; x < _columns; x++)
-                    {
-                        const GLushort d = sChars[y * sCharsWidth + x];
-                        const GLubyte blink = (d >> 15) & 1; // TODO: Implement
-                        if (blink == 1)
-                        {
-                            sDirty = GL_TRUE;
-                            break;
-                        }
-                    }
-                    if (sDirty) break;
-                }
-            }
-        }
-        
-        if (sDirty)
-        {
-            sDirty = GL_FALSE;
-            static const float offsets[8] = {0,0,8,0,0,8,8,8};
-            for (int y = 0; y < _rows; y++)
-            {
-                for (int x = 0; x < _columns; x++)
-                {
-                    const GLushort d = sChars[y * sCharsWidth + x];
-                    const GLushort c = d & 255;
-                    const int row = c / 16;
-                    const int col = c % 16;
-                    const GLubyte bg = (d >> 12) & 7;
-                    const GLubyte bgr = sPalette[bg * 3 + 0];
-                    const GLubyte bgg = sPalette[bg * 3 + 1];
-                    const GLubyte bgb = sPalette[bg * 3 + 2];
-                    const GLubyte blink = (d >> 15) & 1; // TODO: Implement
-                    const GLubyte fg = (d >> 8) & 15;
-                    const GLubyte fgr = (blink == 1 && sBlinkState) ? bgr : sPalette[fg * 3 + 0];
-                    const GLubyte fgg = (blink == 1 && sBlinkState) ? bgg : sPalette[fg * 3 + 1];
-                    const GLubyte fgb = (blink == 1 && sBlinkState) ? bgb : sPalette[fg * 3 + 2];
-                    
-
-                    const GLuint addr = (y * _columns + x) * (4 * 2);
-                    int i = 0;
-                    while(i < 8)
-                    {
-                        sTextureCoordBuffer[addr + i] = (col * 8) + offsets[i]; i++;
-                        sTextureCoordBuffer[addr + i] = (row * 8) + offsets[i]; i++;
-                    }
-                    
-                    const GLuint addr2 = (y * _columns + x) * (4 * 4);
-                    i = 0;
-                    while (i < 16)
-                    {
-                        sFgColorBuffer[addr2 + i] = fgr;
-                        sBgColorBuffer[addr2 + i++] = bgr;
-                        sFgColorBuffer[addr2 + i] = fgg;
-                        sBgColorBuffer[addr2 + i++] = bgg;
-                        sFgColorBuffer[addr2 + i] = fgb;
-                        sBgColorBuffer[addr2 + i++] = bgb;
-                        sFgColorBuffer[addr2 + i] = 255;
-                        sBgColorBuffer[addr2 + i++] = 255;
-                    }
-                }
-            }
-            glBindBuffer(GL_ARRAY_BUFFER, textureCoordHandle);
-            glBufferData(GL_ARRAY_BUFFER, size, sTextureCoordBuffer, GL_DYNAMIC_DRAW);
-            glBindBuffer(GL_ARRAY_BUFFER, fgColorHandle);
-            glBufferData(GL_ARRAY_BUFFER, size, sFgColorBuffer, GL_DYNAMIC_DRAW);
-            glBindBuffer(GL_ARRAY_BUFFER, bgColorHandle);
-            glBufferData(GL_ARRAY_BUFFER, size, sBgColorBuffer, GL_DYNAMIC_DRAW);
-        }
+}
 
-        glClear(GL_COLOR_BUFFER_BIT);
+#if defined(_WIN32)
+#define CGL_POOL_LOCK() EnterCriticalSection(&sPoolLock)
+#define CGL_POOL_UNLOCK() LeaveCriticalSection(&sPoolLock)
+#define CGL_POOL_WAIT(_condition) SleepConditionVariableCS(&_condition, &sPoolLock, INFINITE)
+#define CGL_POOL_SIGNAL(_condition) WakeConditionVariable(&_condition)
+#define CGL_POOL_BROADCAST(_condition) WakeAllConditionVariable(&_condition)
+#else
+#define CGL_POOL_LOCK() pthread_mutex_lock(&sPoolLock)
+#define CGL_POOL_UNLOCK() pthread_mutex_unlock(&sPoolLock)
+#define CGL_POOL_WAIT(_condition) pthread_cond_wait(&_condition, &sPoolLock)
+#define CGL_POOL_SIGNAL(_condition) pthread_cond_signal(&_condition)
+#define CGL_POOL_BROADCAST(_condition) pthread_cond_broadcast(&_condition)
+#endif
 
-        glDisable(GL_TEXTURE_2D);
-        glDisable(GL_BLEND);
-        
-        glBindBuffer(GL_ARRAY_BUFFER, vertexHandle);
-        glEnableClientState(GL_VERTEX_ARRAY);
-        glVertexPointer(3, GL_FLOAT, 0, 0);
-        
-        glBindBuffer(GL_ARRAY_BUFFER, bgColorHandle);
-        glEnableClientState(GL_COLOR_ARRAY);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 0, 0);
-        
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexHandle);
-        glDrawElements(GL_TRIANGLES, _columns * _rows * 6, GL_UNSIGNED_INT, 0);
-        
-        glEnable(GL_TEXTURE_2D);
-        glEnable(GL_BLEND);
-        glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-        glBindTexture(GL_TEXTURE_2D, texId);
-        
-        glBindBuffer(GL_ARRAY_BUFFER, textureCoordHandle);
-        glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-        glTexCoordPointer(2, GL_SHORT, 0, 0);
-        
-        glBindBuffer(GL_ARRAY_BUFFER, fgColorHandle);
-        glEnableClientState(GL_COLOR_ARRAY);
-        glColorPointer(4, GL_UNSIGNED_BYTE, 0, 0);
-        
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexHandle);
-        glDrawElements(GL_TRIANGLES, _columns * _rows * 6, GL_UNSIGNED_INT, 0);
-        
-        /* Swap front and back buffers */
-        glfwSwapBuffers(window);
-        
-        /* Poll for and process events */
-        glfwPollEvents();
+/**
+ * Runs the tasks of the pool until it is freed
+ */
+static void _CGLworkerLoop()
+{
+    unsigned generation = 0;
+    CGL_POOL_LOCK();
+    for (;;)
+    {
+        while (!sPoolExit && generation == sPoolGeneration) CGL_POOL_WAIT(sPoolStart);
+        if (sPoolExit) break;
+        generation = sPoolGeneration;
+        CGL_POOL_UNLOCK();
+        _CGLpoolWork();
+        CGL_POOL_LOCK();
+        if (--sPoolBusy == 0) CGL_POOL_SIGNAL(sPoolDone);
     }
-    
-    glfwTerminate();
-    
-    free(sChars);
-    sChars = NULL;
-    
-    free(sTexture);
-    sTexture = NULL;
+    CGL_POOL_UNLOCK();
+}
 
+#if defined(_WIN32)
+static DWORD WINAPI _CGLworkerMain(LPVOID _unused)
+{
+    (void)_unused;
+    _CGLworkerLoop();
     return 0;
 }
+#else
+static void* _CGLworkerMain(void* _unused)
+{
+    (void)_unused;
+    _CGLworkerLoop();
+    return NULL;
+}
+#endif
 
 /**
- *  Sets the default color attribute used.
- *  bits 0-3 = FG Color
- *  bits 4-6 = BG Color
- *  bit 7 = Blink
+ * Starts a worker per core but the one of the main thread, or CGL_HINT_THREADS - 1 of them
  */
-void CGLsetAttrib(int _attrib)
+static void _CGLinitPool()
 {
-    int pos = sCharsYPos * sCharsWidth + sCharsXPos;
-    if (pos >= sCharsArea || pos < 0) return;
-
-    CGLsetAttribXY(_attrib, sCharsXPos, sCharsYPos);
-
-    sCharsXPos++;
-    if (sCharsXPos >= sCharsWidth)
+    int threads = sThreadsHint > 0 ? sThreadsHint : _CGLcoreCount();
+    if (threads > CGL_POOL_MAX_WORKERS + 1) threads = CGL_POOL_MAX_WORKERS + 1;
+    sPoolExit = GL_FALSE;
+    sPoolGeneration = 0;
+    sWorkerCount = 0;
+#if defined(_WIN32)
+    InitializeCriticalSection(&sPoolLock);
+    InitializeConditionVariable(&sPoolStart);
+    InitializeConditionVariable(&sPoolDone);
+    for (; sWorkerCount < threads - 1; sWorkerCount++)
     {
-        sCharsXPos = 0;
-        sCharsYPos++;
+        sWorkers[sWorkerCount] = CreateThread(NULL, 0, _CGLworkerMain, NULL, 0, NULL);
+        if (!sWorkers[sWorkerCount]) break;
     }
+#else
+    for (; sWorkerCount < threads - 1; sWorkerCount++)
+    {
+        if (pthread_create(&sWorkers[sWorkerCount], NULL, _CGLworkerMain, NULL) != 0) break;
+    }
+#endif
 }
 
 /**
- * Sets the attribute at the specified location
+ * Stops the workers, a pool without any runs its tasks on the main thread
  */
-void CGLsetAttribXY(int _attrib, int _col, int _row)
+static void _CGLfreePool()
 {
-    int pos = _row * sCharsWidth + _col;
-    if (pos >= sCharsArea || pos < 0) return;
-
-    sChars[pos] = (sChars[pos] & 255) | (_attrib << 8);
-    sDirty = GL_TRUE;
+    if (sWorkerCount == 0) return;
+    CGL_POOL_LOCK();
+    sPoolExit = GL_TRUE;
+    CGL_POOL_BROADCAST(sPoolStart);
+    CGL_POOL_UNLOCK();
+    for (int i = 0; i < sWorkerCount; i++)
+    {
+#if defined(_WIN32)
+        WaitForSingleObject(sWorkers[i], INFINITE);
+        CloseHandle(sWorkers[i]);
+#else
+        pthread_join(sWorkers[i], NULL);
+#endif
+    }
+#if defined(_WIN32)
+    DeleteCriticalSection(&sPoolLock);
+#endif
+    sWorkerCount = 0;
 }
 
 /**
- * Moves the cursor to the specified location
+ * Calls _task over items [0, _items) in chunks of _chunk items, spread over the workers and the
+ * calling thread, and returns once all are done
  */
-void CGLgotoXY(int _col, int _row)
+static void _CGLpoolRun(void (*_task)(int _first, int _last), int _items, int _chunk)
 {
-    if (_col < 0) return;
-    if (_row < 0) return;
-    if (_col * _row > sCharsArea) return;
-    sCharsXPos = _col;
-    sCharsYPos = _row;
+    if (sWorkerCount == 0 || _items <= _chunk)
+    {
+        _task(0, _items);
+        return;
+    }
+    CGL_POOL_LOCK();
+    sPoolTask = _task;
+    sPoolItems = _items;
+    sPoolChunk = _chunk;
+    atomic_store(&sPoolNext, 0);
+    sPoolBusy = sWorkerCount;
+    sPoolGeneration++;
+    CGL_POOL_BROADCAST(sPoolStart);
+    CGL_POOL_UNLOCK();
+    _CGLpoolWork();
+    CGL_POOL_LOCK();
+    while (sPoolBusy > 0) CGL_POOL_WAIT(sPoolDone);
+    CGL_POOL_UNLOCK();
 }
 
 /**
- * Print a formatted string
+ * Writes a complete event to the trace, times in seconds of _CGLtime
  */
-void CGLprintf(const char * _format, ...)
+static void _CGLtraceEvent(const char* _name, int _thread, double _start, double _duration)
 {
-    char buffer[sCharsArea];
-    va_list args;
-    va_start (args, _format);
-    vsnprintf (buffer, sCharsArea, _format, args);
-    CGLprint(buffer);
-    va_end (args);
+    fprintf(sTraceFile, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+            sTraceFirst ? "" : ",\n", _name, _thread, (_start - sTraceStart) * 1e6, _duration * 1e6);
+    sTraceFirst = GL_FALSE;
 }
 
-void CGLprint(const char * _string)
+/**
+ * Ends the phase being measured and starts _phase, -1 starts none
+ */
+static void _CGLphase(int _phase)
 {
-    int len = strlen(_string);
-    for (int i = 0; i < len; ++i)
+    const double now = _CGLtime();
+    if (sPhase >= 0)
     {
-        char c = _string[i];
-        switch (c)
-        {
-            case '\n':
-            {
-                sCharsXPos = 0;
-                sCharsYPos++;
-                break;
-            }
-                
-            default:
-            {
-                CGLputc(c);
-                break;
-            }
-        }
+        sFrame.phases[sPhase] += now - sPhaseStart;
+        if (sTraceFile) _CGLtraceEvent(sPhaseNames[sPhase], 1, sPhaseStart, now - sPhaseStart);
     }
+    sPhase = _phase;
+    sPhaseStart = now;
 }
 
 /**
- * Prints a single char to the screen
+ * Starts measuring a frame with its tick
  */
-void CGLputc(char _char)
+static void _CGLframeBegin()
 {
-    int pos = sCharsYPos * sCharsWidth + sCharsXPos++;
-    if (pos >= sCharsArea || pos < 0) return;
-    sChars[pos] = _char | sLastAttrib;
-    sDirty = GL_TRUE;
-    if (sCharsXPos == sCharsWidth)
-    {
-        sCharsXPos = 0;
-        sCharsYPos++;
-    }
+    memset(&sFrame, 0, sizeof(sFrame));
+    sFrame.gpu = -1.0;
+    _CGLphase(CGL_PHASE_TICK);
+    sFrameStart = sPhaseStart;
 }
 
 /**
- * Prints a single char to the screen
+ * Ends the frame being measured and adds it to the statistics
  */
-void CGLputcXY(char _char, int _col, int _row)
+static void _CGLframeEnd()
 {
-    int pos = _row * sCharsWidth + _col;
-    if(pos >= sCharsArea || pos < 0) return;
-    sChars[pos] = _char;
-    sDirty = GL_TRUE;
+    _CGLphase(-1);
+    sFrame.time = sPhaseStart - sFrameStart;
+    sFrames[sFrameCount % CGL_STATS_FRAMES] = sFrame;
+    sFrameCount++;
+    if (!sTraceFile) return;
+    _CGLtraceEvent("frame", 0, sFrameStart, sFrame.time);
+    fprintf(sTraceFile, ",\n{\"name\":\"cells\",\"ph\":\"C\",\"pid\":1,\"ts\":%.3f,\"args\":{\"changed\":%lld,\"rebuilt\":%lld,\"uploaded\":%lld}}",
+            (sFrameStart - sTraceStart) * 1e6, sFrame.cellsChanged, sFrame.cellsRebuilt, sFrame.bytesUploaded);
 }
 
 /**
- * Closes the window and cleans up
+ * Creates the GPU timer queries when the context has them
  */
-void CGLshutdown()
+static void _CGLinitTimers()
+{
+    int major = 0;
+    int minor = 0;
+    const char* version = (const char*)glGetString(GL_VERSION);
+    if (version) sscanf(version, "%d.%d", &major, &minor);
+    
+#define CGL_GL_LOAD(_type, _name) sGL._name = (_type)glfwGetProcAddress("gl" #_name);
+    CGL_GL_TIMER_FUNCTIONS(CGL_GL_LOAD)
+#undef CGL_GL_LOAD
+    
+    sTimerActive = (major * 10 + minor >= 33 || glfwExtensionSupported("GL_ARB_timer_query")) && sGL.GenQueries && sGL.DeleteQueries &&
+                   sGL.BeginQuery && sGL.EndQuery && sGL.GetQueryObjectiv && sGL.GetQueryObjectui64v;
+    if (!sTimerActive) return;
+    sGL.GenQueries(CGL_TIMER_QUERIES, sTimerQueries);
+    for (int i = 0; i < CGL_TIMER_QUERIES; i++) sTimerFrames[i] = -1;
+    sTimerNext = 0;
+}
+
+/**
+ * Starts timing the draws of the current frame on the GPU, unless every query is still in flight.
+ * Results of earlier frames are collected without waiting for the GPU.
+ */
+static GLboolean _CGLbeginTimer()
+{
+    if (!sTimerActive) return GL_FALSE;
+    for (int i = 0; i < CGL_TIMER_QUERIES; i++)
+    {
+        if (sTimerFrames[i] < 0) continue;
+        GLint available = 0;
+        sGL.GetQueryObjectiv(sTimerQueries[i], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) continue;
+        GLuint64 elapsed = 0;
+        sGL.GetQueryObjectui64v(sTimerQueries[i], GL_QUERY_RESULT, &elapsed);
+        const double seconds = elapsed * 1e-9;
+        if (sFrameCount - sTimerFrames[i] <= CGL_STATS_FRAMES) sFrames[sTimerFrames[i] % CGL_STATS_FRAMES].gpu = seconds;
+        if (sTraceFile) _CGLtraceEvent("gpu draw", 2, sTimerStarts[i], seconds);
+        sTimerFrames[i] = -1;
+    }
+    if (sTimerFrames[sTimerNext] >= 0) return GL_FALSE;
+    sGL.BeginQuery(GL_TIME_ELAPSED, sTimerQueries[sTimerNext]);
+    sTimerFrames[sTimerNext] = sFrameCount;
+    sTimerStarts[sTimerNext] = sPhaseStart;
+    return GL_TRUE;
+}
+
+/**
+ * Ends the GPU timing started by _CGLbeginTimer
+ */
+static void _CGLendTimer()
+{
+    sGL.EndQuery(GL_TIME_ELAPSED);
+    sTimerNext = (sTimerNext + 1) % CGL_TIMER_QUERIES;
+}
+
+/**
+ * Closes the trace file
+ */
+static void _CGLtraceStop()
+{
+    if (!sTraceFile) return;
+    fprintf(sTraceFile, "\n]\n");
+    fclose(sTraceFile);
+    sTraceFile = NULL;
+}
+
+/**
+ * Orders frame times
+ */
+static int _CGLcompareTimes(const void* _a, const void* _b)
+{
+    const double a = *(const double*)_a;
+    const double b = *(const double*)_b;
+    return a < b ? -1 : a > b;
+}
+
+/**
+ * Returns the nearest rank percentile of _count sorted times
+ */
+static double _CGLpercentile(const double* _times, int _count, int _percent)
+{
+    return _times[(_count * _percent + 99) / 100 - 1];
+}
+
+/**
+ * Queues an input event received now, dropping the oldest when the queue is full
+ */
+static CGLevent* _CGLqueueEvent(int _type)
+{
+    if (sEventCount == CGL_EVENT_QUEUE)
+    {
+        sEventFirst = (sEventFirst + 1) % CGL_EVENT_QUEUE;
+        sEventCount--;
+    }
+    CGLevent* event = &sEvents[(sEventFirst + sEventCount++) % CGL_EVENT_QUEUE];
+    memset(event, 0, sizeof(*event));
+    event->type = _type;
+    event->time = _CGLtime() - sEventBase;
+    return event;
+}
+
+/**
+ * Measures the input to present time of the events taken this frame, once it is presented
+ */
+static void _CGLpresentInput(GLboolean _presented)
+{
+    const double now = _CGLtime() - sEventBase;
+    for (int i = 0; _presented && i < sTakenCount; i++)
+    {
+        sLatencies[sLatencyCount++ % CGL_STATS_FRAMES] = now - sTakenTimes[i];
+        if (sTraceFile) _CGLtraceEvent(sEventNames[sTakenTypes[i]], 3, sEventBase + sTakenTimes[i], now - sTakenTimes[i]);
+    }
+    // Events a frame that draws nothing took never reach the screen
+    sTakenCount = 0;
+}
+
+/**
+ * Returns the row of sChars that holds a screen row
+ */
+static int _CGLrow(int _row)
+{
+    const int row = _row + sRowOrigin;
+    return row >= sCharsHeight ? row - sCharsHeight : row;
+}
+
+/**
+ * Copies the statics of the current console into its context
+ */
+static void _CGLstoreContext(CGLContext* _context)
+{
+#define CGL_CONTEXT_STORE(_type, _name) _context->_name = s##_name;
+    CGL_CONTEXT_STATE(CGL_CONTEXT_STORE)
+#undef CGL_CONTEXT_STORE
+    memcpy(_context->FeedParams, sFeedParams, sizeof(sFeedParams));
+}
+
+/**
+ * Copies a context into the statics
+ */
+static void _CGLloadContext(const CGLContext* _context)
+{
+#define CGL_CONTEXT_LOAD(_type, _name) s##_name = _context->_name;
+    CGL_CONTEXT_STATE(CGL_CONTEXT_LOAD)
+#undef CGL_CONTEXT_LOAD
+    memcpy(sFeedParams, _context->FeedParams, sizeof(sFeedParams));
+}
+
+/**
+ * Calls a function with each console current in turn, in draw order
+ */
+static void _CGLforEachContext(void (*_function)(void))
+{
+    CGLContext* current = sContext;
+    _CGLstoreContext(current);
+    for (sContext = sContexts; sContext; sContext = sContext->next)
+    {
+        _CGLloadContext(sContext);
+        _function();
+        _CGLstoreContext(sContext);
+    }
+    sContext = current;
+    _CGLloadContext(current);
+}
+
+/**
+ * Fills sColors with the 16 console colors, the 6x6x6 color cube and 24 grays
+ */
+static void _CGLinitPalette()
+{
+    static const GLubyte levels[6] = {0x00, 0x5f, 0x87, 0xaf, 0xd7, 0xff};
+    if (sColorsReady) return;
+    memcpy(sColors, sPalette, sizeof(sPalette));
+    for (int i = 0; i < 216; i++)
+    {
+        sColors[(16 + i) * 3 + 0] = levels[i / 36];
+        sColors[(16 + i) * 3 + 1] = levels[i / 6 % 6];
+        sColors[(16 + i) * 3 + 2] = levels[i % 6];
+    }
+    for (int i = 0; i < 24; i++)
+    {
+        sColors[(232 + i) * 3 + 0] = sColors[(232 + i) * 3 + 1] = sColors[(232 + i) * 3 + 2] = 8 + i * 10;
+    }
+    sColorsReady = GL_TRUE;
+}
+
+/**
+ * Returns the fg | bg << 8 color pair held in the attribute bits of a cell
+ */
+static GLushort _CGLattribColors(GLushort _cell)
+{
+    return ((_cell >> 8) & 15) | (((_cell >> 12) & 7) << 8);
+}
+
+/**
+ * Sets _count cells to the same value
+ */
+static void _CGLfillCells(GLushort* _dst, GLushort _value, int _count)
+{
+    int i = 0;
+#if defined(CGL_SSE2)
+    const __m128i values = _mm_set1_epi16((short)_value);
+    for (; i + 16 <= _count; i += 16)
+    {
+        _mm_storeu_si128((__m128i*)(_dst + i), values);
+        _mm_storeu_si128((__m128i*)(_dst + i + 8), values);
+    }
+#elif defined(CGL_NEON)
+    const uint16x8_t values = vdupq_n_u16(_value);
+    for (; i + 16 <= _count; i += 16)
+    {
+        vst1q_u16(_dst + i, values);
+        vst1q_u16(_dst + i + 8, values);
+    }
+#endif
+    for (; i < _count; i++) _dst[i] = _value;
+}
+
+/**
+ * Replaces the bits set in _mask of _count cells with those of _value
+ */
+static void _CGLblendCells(GLushort* _dst, GLushort _value, GLushort _mask, int _count)
+{
+    const GLushort bits = _value & _mask;
+    int i = 0;
+#if defined(CGL_SSE2)
+    const __m128i keep = _mm_set1_epi16((short)~_mask);
+    const __m128i values = _mm_set1_epi16((short)bits);
+    for (; i + 8 <= _count; i += 8)
+    {
+        const __m128i cells = _mm_loadu_si128((const __m128i*)(_dst + i));
+        _mm_storeu_si128((__m128i*)(_dst + i), _mm_or_si128(_mm_and_si128(cells, keep), values));
+    }
+#elif defined(CGL_NEON)
+    const uint16x8_t mask = vdupq_n_u16(_mask);
+    const uint16x8_t values = vdupq_n_u16(bits);
+    for (; i + 8 <= _count; i += 8)
+    {
+        vst1q_u16(_dst + i, vbslq_u16(mask, values, vld1q_u16(_dst + i)));
+    }
+#endif
+    for (; i < _count; i++) _dst[i] = (_dst[i] & ~_mask) | bits;
+}
+
+/**
+ * Sets the colors of columns [_first, _last) of a row of sChars when the color plane is in use
+ */
+static void _CGLfillColors(int _row, int _first, int _last, GLushort _colors)
+{
+    if (!sCellColors || _first >= _last) return;
+    _CGLfillCells(sCellColors + _row * sCharsWidth + _first, _colors, _last - _first);
+}
+
+/**
+ * Marks columns [_first, _last) of a row of sChars as needing a rebuild
+ */
+static void _CGLmarkDirty(int _row, int _first, int _last)
+{
+    if (_first < sDirtyMin[_row]) sDirtyMin[_row] = _first;
+    if (_last > sDirtyMax[_row]) sDirtyMax[_row] = _last;
+    sDirty = GL_TRUE;
+}
+
+/**
+ * Marks the whole screen as needing a rebuild
+ */
+static void _CGLmarkAllDirty()
+{
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        sDirtyMin[y] = 0;
+        sDirtyMax[y] = sCharsWidth;
+    }
+    sDirty = GL_TRUE;
+}
+
+/**
+ * Counts the blinking cells in a run
+ */
+static int _CGLcountBlinks(const GLushort* _cells, int _count)
+{
+    int blinks = 0;
+    int i = 0;
+#if defined(CGL_SSE2)
+    // Blink bits become 0 or 1 per lane, summed into 32-bit lanes so long runs cannot overflow
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i sums = _mm_setzero_si128();
+    for (; i + 8 <= _count; i += 8)
+    {
+        const __m128i cells = _mm_loadu_si128((const __m128i*)(_cells + i));
+        sums = _mm_add_epi32(sums, _mm_madd_epi16(_mm_srli_epi16(cells, 15), ones));
+    }
+    int32_t lanes[4];
+    _mm_storeu_si128((__m128i*)lanes, sums);
+    blinks = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(CGL_NEON)
+    uint32x4_t sums = vdupq_n_u32(0);
+    for (; i + 8 <= _count; i += 8) sums = vpadalq_u16(sums, vshrq_n_u16(vld1q_u16(_cells + i), 15));
+    uint32_t lanes[4];
+    vst1q_u32(lanes, sums);
+    blinks = (int)(lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+#endif
+    for (; i < _count; i++) blinks += _cells[i] >> 15;
+    return blinks;
+}
+
+/**
+ * Adjusts the blinking cell count of a row of sChars
+ */
+static void _CGLaddBlinks(int _row, int _delta)
+{
+    sRowBlinks[_row] += _delta;
+    sBlinkCount += _delta;
+}
+
+/**
+ * Writes one cell of sChars, keeping the blink count and dirty spans current
+ */
+static void _CGLsetCell(int _row, int _col, GLushort _cell, GLushort _colors)
+{
+    GLushort* cell = sChars + _row * sCharsWidth + _col;
+    _CGLaddBlinks(_row, (_cell >> 15) - (*cell >> 15));
+    *cell = _cell;
+    _CGLfillColors(_row, _col, _col + 1, _colors);
+    _CGLmarkDirty(_row, _col, _col + 1);
+}
+
+/**
+ * Marks the screen rectangle [_x0, _x1) x [_y0, _y1) as needing a rebuild
+ */
+static void _CGLmarkDirtyRect(int _x0, int _y0, int _x1, int _y1)
+{
+    for (int y = _y0; y < _y1; y++)
+    {
+        const int row = _CGLrow(y);
+        if (_x0 < sDirtyMin[row]) sDirtyMin[row] = _x0;
+        if (_x1 > sDirtyMax[row]) sDirtyMax[row] = _x1;
+    }
+    sDirty = GL_TRUE;
+}
+
+/**
+ * Fills screen rows [_first, _last) with a cell value and color pair
+ */
+static void _CGLclearRows(int _first, int _last, GLushort _cell, GLushort _colors)
+{
+    for (int y = _first; y < _last; y++)
+    {
+        _CGLfillCells(sChars + _CGLrow(y) * sCharsWidth, _cell, sCharsWidth);
+        _CGLaddBlinks(_CGLrow(y), (_cell >> 15) * sCharsWidth - sRowBlinks[_CGLrow(y)]);
+        _CGLfillColors(_CGLrow(y), 0, sCharsWidth, _colors);
+    }
+    _CGLmarkDirtyRect(0, _first, sCharsWidth, _last);
+}
+
+/**
+ * Copies screen row _src over screen row _dst
+ */
+static void _CGLcopyRow(int _dst, int _src)
+{
+    const int dst = _CGLrow(_dst);
+    const int src = _CGLrow(_src);
+    memcpy(sChars + dst * sCharsWidth, sChars + src * sCharsWidth, sCharsWidth * sizeof(GLushort));
+    if (sCellColors) memcpy(sCellColors + dst * sCharsWidth, sCellColors + src * sCharsWidth, sCharsWidth * sizeof(GLushort));
+    _CGLaddBlinks(dst, sRowBlinks[src] - sRowBlinks[dst]);
+}
+
+/**
+ * Moves the cursor to the next line, scrolling at the bottom of the scroll region
+ */
+static void _CGLlineFeed()
+{
+    sCharsXPos = 0;
+    if (sCharsYPos == sScrollBottom - 1) CGLscroll(1);
+    else if (sCharsYPos < sCharsHeight - 1) sCharsYPos++;
+}
+
+/**
+ * Writes _count chars with the current attribute and colors into a row of sChars starting at _col
+ */
+static void _CGLputRun(int _row, int _col, const char* _chars, int _count)
+{
+    const GLushort attrib = sLastAttrib;
+    GLushort* dst = sChars + _row * sCharsWidth + _col;
+    const unsigned char* src = (const unsigned char*)_chars;
+    _CGLaddBlinks(_row, ((attrib >> 15) & 1) * _count - _CGLcountBlinks(dst, _count));
+    int i = 0;
+#if defined(CGL_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i attribs = _mm_set1_epi16((short)attrib);
+    for (; i + 16 <= _count; i += 16)
+    {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_unpacklo_epi8(bytes, zero), attribs));
+        _mm_storeu_si128((__m128i*)(dst + i + 8), _mm_or_si128(_mm_unpackhi_epi8(bytes, zero), attribs));
+    }
+#elif defined(CGL_NEON)
+    const uint16x8_t attribs = vdupq_n_u16(attrib);
+    for (; i + 16 <= _count; i += 16)
+    {
+        const uint8x16_t bytes = vld1q_u8(src + i);
+        vst1q_u16(dst + i, vorrq_u16(vmovl_u8(vget_low_u8(bytes)), attribs));
+        vst1q_u16(dst + i + 8, vorrq_u16(vmovl_u8(vget_high_u8(bytes)), attribs));
+    }
+#endif
+    for (; i < _count; i++)
+    {
+        dst[i] = src[i] | attrib;
+    }
+    _CGLfillColors(_row, _col, _col + _count, sLastColors);
+    _CGLmarkDirty(_row, _col, _col + _count);
+}
+
+/**
+ * Fills columns [_first, _last) of a screen row with a cell value and color pair
+ */
+static void _CGLfillSpan(int _row, int _first, int _last, GLushort _cell, GLushort _colors)
+{
+    if (_first >= _last) return;
+    const int row = _CGLrow(_row);
+    GLushort* dst = sChars + row * sCharsWidth;
+    _CGLaddBlinks(row, (_cell >> 15) * (_last - _first) - _CGLcountBlinks(dst + _first, _last - _first));
+    _CGLfillCells(dst + _first, _cell, _last - _first);
+    _CGLfillColors(row, _first, _last, _colors);
+    _CGLmarkDirty(row, _first, _last);
+}
+
+/**
+ * Clips a rectangle against the screen, returns GL_FALSE if nothing is left
+ */
+static GLboolean _CGLclipRect(int _x, int _y, int _w, int _h, int* _x0, int* _y0, int* _x1, int* _y1)
+{
+    *_x0 = _x < 0 ? 0 : _x;
+    *_y0 = _y < 0 ? 0 : _y;
+    *_x1 = _x + _w > sCharsWidth ? sCharsWidth : _x + _w;
+    *_y1 = _y + _h > sCharsHeight ? sCharsHeight : _y + _h;
+    return *_x0 < *_x1 && *_y0 < *_y1;
+}
+
+/**
+ * Fills a rectangle of the screen, clipped, with a cell value and color pair
+ */
+static void _CGLfillRect(GLushort _cell, GLushort _colors, int _col, int _row, int _width, int _height)
+{
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_col, _row, _width, _height, &x0, &y0, &x1, &y1)) return;
+    for (int y = y0; y < y1; y++)
+    {
+        const int row = _CGLrow(y);
+        GLushort* dst = sChars + row * sCharsWidth + x0;
+        _CGLaddBlinks(row, (_cell >> 15) * (x1 - x0) - _CGLcountBlinks(dst, x1 - x0));
+        _CGLfillCells(dst, _cell, x1 - x0);
+        _CGLfillColors(row, x0, x1, _colors);
+    }
+    _CGLmarkDirtyRect(x0, y0, x1, y1);
+}
+
+/**
+ * Draws _count cells of a layer over composited cells, except where the layer is transparent
+ */
+static void _CGLblendLayer(GLushort* _cells, GLushort* _colors, const GLushort* _layer, const GLushort* _layerColors, GLushort _transparent, int _count)
+{
+    int i = 0;
+#if defined(CGL_SSE2)
+    const __m128i transparent = _mm_set1_epi16((short)_transparent);
+    for (; i + 8 <= _count; i += 8)
+    {
+        const __m128i cells = _mm_loadu_si128((const __m128i*)(_layer + i));
+        const __m128i under = _mm_cmpeq_epi16(cells, transparent);
+        const __m128i shown = _mm_loadu_si128((const __m128i*)(_cells + i));
+        _mm_storeu_si128((__m128i*)(_cells + i), _mm_or_si128(_mm_and_si128(under, shown), _mm_andnot_si128(under, cells)));
+        if (!_colors) continue;
+        const __m128i colors = _mm_loadu_si128((const __m128i*)(_layerColors + i));
+        const __m128i shownColors = _mm_loadu_si128((const __m128i*)(_colors + i));
+        _mm_storeu_si128((__m128i*)(_colors + i), _mm_or_si128(_mm_and_si128(under, shownColors), _mm_andnot_si128(under, colors)));
+    }
+#elif defined(CGL_NEON)
+    const uint16x8_t transparent = vdupq_n_u16(_transparent);
+    for (; i + 8 <= _count; i += 8)
+    {
+        const uint16x8_t cells = vld1q_u16(_layer + i);
+        const uint16x8_t under = vceqq_u16(cells, transparent);
+        vst1q_u16(_cells + i, vbslq_u16(under, vld1q_u16(_cells + i), cells));
+        if (_colors) vst1q_u16(_colors + i, vbslq_u16(under, vld1q_u16(_colors + i), vld1q_u16(_layerColors + i)));
+    }
+#endif
+    for (; i < _count; i++)
+    {
+        if (_layer[i] == _transparent) continue;
+        _cells[i] = _layer[i];
+        if (_colors) _colors[i] = _layerColors[i];
+    }
+}
+
+/**
+ * Marks the cells of the current console under a layer, with screen rows starting at row _origin of sChars
+ */
+static void _CGLmarkUnder(const CGLContext* _layer, int _origin)
+{
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_layer->PaneCol, _layer->PaneRow, _layer->CharsWidth, _layer->CharsHeight, &x0, &y0, &x1, &y1)) return;
+    for (int y = y0; y < y1; y++) _CGLmarkDirty((y + _origin) % sCharsHeight, x0, x1);
+}
+
+/**
+ * Brings the composited cells of the current console up to date where it or its layers changed
+ */
+static void _CGLcomposeLayers()
+{
+    // Layers stay in place on the screen while the rows of the console rotate under them
+    if (sComposeOrigin != sRowOrigin)
+    {
+        for (const CGLContext* layer = sLayers; layer; layer = layer->next)
+        {
+            if (!layer->visible) continue;
+            _CGLmarkUnder(layer, sComposeOrigin);
+            _CGLmarkUnder(layer, sRowOrigin);
+        }
+        sComposeOrigin = sRowOrigin;
+    }
+    
+    // Take the changes of each layer as changes of the cells under it
+    for (CGLContext* layer = sLayers; layer; layer = layer->next)
+    {
+        if (layer->visible && layer->ComposeOrigin != layer->RowOrigin) _CGLmarkUnder(layer, sRowOrigin);
+        layer->ComposeOrigin = layer->RowOrigin;
+        for (int y = 0; y < layer->CharsHeight; y++)
+        {
+            const int row = (y + layer->RowOrigin) % layer->CharsHeight;
+            const int screenRow = layer->PaneRow + y;
+            int first = layer->PaneCol + layer->DirtyMin[row];
+            int last = layer->PaneCol + layer->DirtyMax[row];
+            layer->DirtyMin[row] = layer->CharsWidth;
+            layer->DirtyMax[row] = 0;
+            if (!layer->visible || screenRow < 0 || screenRow >= sCharsHeight) continue;
+            if (first < 0) first = 0;
+            if (last > sCharsWidth) last = sCharsWidth;
+            if (first < last) _CGLmarkDirty(_CGLrow(screenRow), first, last);
+        }
+    }
+    
+    // Every changed cell is copied from the console, then drawn over by the layers that cover it
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        const int first = sDirtyMin[y];
+        const int last = sDirtyMax[y];
+        if (first >= last) continue;
+        const int offset = y * sCharsWidth;
+        memcpy(sShown + offset + first, sChars + offset + first, (last - first) * sizeof(GLushort));
+        if (sCellColors) memcpy(sShownColors + offset + first, sCellColors + offset + first, (last - first) * sizeof(GLushort));
+        
+        const int screenRow = (y - sRowOrigin + sCharsHeight) % sCharsHeight;
+        for (const CGLContext* layer = sLayers; layer; layer = layer->next)
+        {
+            const int layerRow = screenRow - layer->PaneRow;
+            if (!layer->visible || layerRow < 0 || layerRow >= layer->CharsHeight) continue;
+            const int x0 = first > layer->PaneCol ? first : layer->PaneCol;
+            const int x1 = last < layer->PaneCol + layer->CharsWidth ? last : layer->PaneCol + layer->CharsWidth;
+            if (x0 >= x1) continue;
+            const int source = ((layerRow + layer->RowOrigin) % layer->CharsHeight) * layer->CharsWidth + x0 - layer->PaneCol;
+            _CGLblendLayer(sShown + offset + x0, sCellColors ? sShownColors + offset + x0 : NULL,
+                           layer->Chars + source, layer->CellColors ? layer->CellColors + source : NULL, layer->transparent, x1 - x0);
+        }
+    }
+}
+
+/**
+ * Calls a renderer function with each console current in turn, in draw order, showing the
+ * composited cells of the consoles that have layers in place of their own cells
+ */
+static void _CGLforEachShown(void (*_function)(void))
+{
+    CGLContext* current = sContext;
+    _CGLstoreContext(current);
+    for (sContext = sContexts; sContext; sContext = sContext->next)
+    {
+        _CGLloadContext(sContext);
+        GLushort* chars = sChars;
+        GLushort* colors = sCellColors;
+        if (sLayers)
+        {
+            _CGLcomposeLayers();
+            sChars = sShown;
+            sCellColors = sShownColors;
+        }
+        _function();
+        sChars = chars;
+        sCellColors = colors;
+        _CGLstoreContext(sContext);
+    }
+    sContext = current;
+    _CGLloadContext(current);
+}
+
+/**
+ * Packs the palette as RGBA pixels for the rebuild, blinking foregrounds get a lower alpha
+ * so the alpha test can hide them
+ */
+static void _CGLbuildPixels()
+{
+    for (int i = 0; i < 256; i++)
+    {
+        GLubyte rgba[4] = {sColors[i * 3 + 0], sColors[i * 3 + 1], sColors[i * 3 + 2], 255};
+        memcpy(&sBgPixels[i], rgba, sizeof(uint32_t));
+        memcpy(&sFgPixels[0][i], rgba, sizeof(uint32_t));
+        rgba[3] = 128;
+        memcpy(&sFgPixels[1][i], rgba, sizeof(uint32_t));
+    }
+}
+
+/**
+ * Regenerates texture coordinates and colors, and the vertices when asked, for the cells of a job
+ */
+static void _CGLrebuildCells(const CGLrebuildJob* _job)
+{
+    const GLshort offsets[8] = {0, 0, sGlyphWidth, 0, 0, sGlyphHeight, sGlyphWidth, sGlyphHeight};
+#if defined(CGL_SSE2)
+    const __m128i offsetVector = _mm_loadu_si128((const __m128i*)offsets);
+#elif defined(CGL_NEON)
+    const int16x8_t offsetVector = vld1q_s16(offsets);
+#endif
+    for (int i = 0; i < _job->count; i++)
+    {
+        const GLushort d = _job->chars[i];
+        const GLushort c = d & 255;
+        const GLushort colors = _job->colors ? _job->colors[i] : _CGLattribColors(d);
+        const GLshort corner[2] = {(c % 16) * sGlyphWidth, (c / 16) * sGlyphHeight};
+        const uint32_t fg = sFgPixels[d >> 15][colors & 255];
+        const uint32_t bg = sBgPixels[colors >> 8];
+        uint32_t cornerPair;
+        memcpy(&cornerPair, corner, sizeof(cornerPair));
+        
+        // Each of the four vertices gets the glyph corner plus its offset and the same colors
+        const int cell = _job->dst + i;
+        GLshort* texCoords = sTextureCoordBuffer + cell * 4 * 2;
+        GLubyte* fgColors = sFgColorBuffer + cell * 4 * 4;
+        GLubyte* bgColors = sBgColorBuffer + cell * 4 * 4;
+#if defined(CGL_SSE2)
+        _mm_storeu_si128((__m128i*)texCoords, _mm_add_epi16(_mm_set1_epi32((int)cornerPair), offsetVector));
+        _mm_storeu_si128((__m128i*)fgColors, _mm_set1_epi32((int)fg));
+        _mm_storeu_si128((__m128i*)bgColors, _mm_set1_epi32((int)bg));
+#elif defined(CGL_NEON)
+        vst1q_s16(texCoords, vaddq_s16(vreinterpretq_s16_u32(vdupq_n_u32(cornerPair)), offsetVector));
+        vst1q_u8(fgColors, vreinterpretq_u8_u32(vdupq_n_u32(fg)));
+        vst1q_u8(bgColors, vreinterpretq_u8_u32(vdupq_n_u32(bg)));
+#else
+        for (int j = 0; j < 8; j++) texCoords[j] = corner[j & 1] + offsets[j];
+        for (int j = 0; j < 16; j += 4)
+        {
+            memcpy(fgColors + j, &fg, sizeof(fg));
+            memcpy(bgColors + j, &bg, sizeof(bg));
+        }
+#endif
+    }
+    
+    if (_job->x < 0) return;
+    
+    // Quads step right by a glyph, the three vectors of a quad step by it where they hold an x
+    GLfloat* quad = sVertexBuffer + _job->dst * 4 * 3;
+    const GLfloat w = sGlyphWidth;
+    const GLfloat h = sGlyphHeight;
+    const GLfloat left = _job->x;
+    const GLfloat top = _job->y;
+    const GLfloat corners[12] = {left, top, 0, left + w, top, 0, left, top + h, 0, left + w, top + h, 0};
+    const GLfloat steps[12] = {w, 0, 0, w, 0, 0, w, 0, 0, w, 0, 0};
+#if defined(CGL_SSE2)
+    __m128 a = _mm_loadu_ps(corners);
+    __m128 b = _mm_loadu_ps(corners + 4);
+    __m128 c = _mm_loadu_ps(corners + 8);
+    const __m128 stepA = _mm_loadu_ps(steps);
+    const __m128 stepB = _mm_loadu_ps(steps + 4);
+    const __m128 stepC = _mm_loadu_ps(steps + 8);
+    for (int i = 0; i < _job->count; i++, quad += 4 * 3)
+    {
+        _mm_storeu_ps(quad, a);
+        _mm_storeu_ps(quad + 4, b);
+        _mm_storeu_ps(quad + 8, c);
+        a = _mm_add_ps(a, stepA);
+        b = _mm_add_ps(b, stepB);
+        c = _mm_add_ps(c, stepC);
+    }
+#elif defined(CGL_NEON)
+    float32x4_t a = vld1q_f32(corners);
+    float32x4_t b = vld1q_f32(corners + 4);
+    float32x4_t c = vld1q_f32(corners + 8);
+    const float32x4_t stepA = vld1q_f32(steps);
+    const float32x4_t stepB = vld1q_f32(steps + 4);
+    const float32x4_t stepC = vld1q_f32(steps + 8);
+    for (int i = 0; i < _job->count; i++, quad += 4 * 3)
+    {
+        vst1q_f32(quad, a);
+        vst1q_f32(quad + 4, b);
+        vst1q_f32(quad + 8, c);
+        a = vaddq_f32(a, stepA);
+        b = vaddq_f32(b, stepB);
+        c = vaddq_f32(c, stepC);
+    }
+#else
+    for (int i = 0; i < _job->count; i++, quad += 4 * 3)
+    {
+        for (int j = 0; j < 12; j++) quad[j] = corners[j] + steps[j] * i;
+    }
+#endif
+}
+
+/**
+ * Runs rebuild jobs [_first, _last), a pool task
+ */
+static void _CGLrunRebuildJobs(int _first, int _last)
+{
+    for (int i = _first; i < _last; i++) _CGLrebuildCells(&sRebuildJobs[i]);
+}
+
+/**
+ * Queues _count cells of the current console from cell _src of sChars to cell _dst of the client side
+ * buffers, with their quads from pixel _x, _y unless _x < 0. Runs them at once when the queue cannot grow.
+ */
+static void _CGLqueueRebuild(int _src, int _dst, int _count, int _x, int _y)
+{
+    const CGLrebuildJob job = {sChars + _src, sCellColors ? sCellColors + _src : NULL, _dst, _count, _x, _y};
+    if (sRebuildJobCount == sRebuildJobCapacity)
+    {
+        const int capacity = sRebuildJobCapacity ? sRebuildJobCapacity * 2 : 256;
+        CGLrebuildJob* jobs = realloc(sRebuildJobs, capacity * sizeof(CGLrebuildJob));
+        if (!jobs)
+        {
+            _CGLbuildPixels();
+            _CGLrebuildCells(&job);
+            return;
+        }
+        sRebuildJobs = jobs;
+        sRebuildJobCapacity = capacity;
+    }
+    sRebuildJobs[sRebuildJobCount++] = job;
+    sRebuildCells += _count;
+}
+
+/**
+ * Runs the queued rebuild jobs, across the worker pool when there are enough cells
+ */
+static void _CGLrunRebuild()
+{
+    if (sRebuildJobCount == 0) return;
+    sFrame.cellsRebuilt += sRebuildCells;
+    _CGLbuildPixels();
+    if (sRebuildCells < CGL_POOL_MIN_CELLS) _CGLrunRebuildJobs(0, sRebuildJobCount);
+    else _CGLpoolRun(_CGLrunRebuildJobs, sRebuildJobCount, CGL_POOL_CHUNK_JOBS);
+    sRebuildJobCount = 0;
+    sRebuildCells = 0;
+}
+
+/**
+ * Returns a client side buffer of the fixed renderer, in the order of sBufferHandles
+ */
+static const GLubyte* _CGLbufferSource(int _buffer)
+{
+    const GLubyte* sources[CGL_FIXED_BUFFERS] = {(const GLubyte*)sVertexBuffer, (const GLubyte*)sTextureCoordBuffer, sFgColorBuffer, sBgColorBuffer};
+    return sources[_buffer];
+}
+
+/**
+ * Sends cells [_first, _last) of the client side buffers to the VBOs, with the vertices when _vertices is set
+ */
+static void _CGLuploadCells(int _first, int _last, GLboolean _vertices)
+{
+    for (int b = _vertices ? 0 : 1; b < CGL_FIXED_BUFFERS; b++)
+    {
+        const GLsizeiptr cellSize = sBufferCellSizes[b];
+        glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+        glBufferSubData(GL_ARRAY_BUFFER, _first * cellSize, (_last - _first) * cellSize, _CGLbufferSource(b) + _first * cellSize);
+        sFrame.bytesUploaded += (_last - _first) * cellSize;
+    }
+}
+
+/**
+ * Copies cells [_first, _last) of the client side buffers into the segment being written,
+ * with the vertices when _vertices is set
+ */
+static void _CGLstreamCells(int _first, int _last, GLboolean _vertices)
+{
+    for (int b = _vertices ? 0 : 1; b < CGL_FIXED_BUFFERS; b++)
+    {
+        const GLsizeiptr cellSize = sBufferCellSizes[b];
+        const GLsizeiptr offset = ((GLsizeiptr)sStreamSegment * sCellCount + _first) * cellSize;
+        const GLsizeiptr size = (_last - _first) * cellSize;
+        const GLubyte* source = _CGLbufferSource(b) + _first * cellSize;
+        sFrame.bytesUploaded += size;
+        if (sStreamMaps[b])
+        {
+            memcpy(sStreamMaps[b] + offset, source, size);
+            if (sStreamMode == CGL_STREAM_PERSISTENT) continue;
+            glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+            sGL.FlushMappedBufferRange(GL_ARRAY_BUFFER, offset, size);
+        }
+        else
+        {
+            // A buffer that failed to map this frame is written through the driver
+            glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+            glBufferSubData(GL_ARRAY_BUFFER, offset, size, source);
+        }
+    }
+}
+
+/**
+ * Picks how the fixed renderer streams its VBOs from what the context supports
+ */
+static void _CGLinitStream()
+{
+    int major = 0;
+    int minor = 0;
+    const char* version = (const char*)glGetString(GL_VERSION);
+    if (version) sscanf(version, "%d.%d", &major, &minor);
+    const int number = major * 10 + minor;
+    
+#define CGL_GL_LOAD(_type, _name) sGL._name = (_type)glfwGetProcAddress("gl" #_name);
+    CGL_GL_STREAM_FUNCTIONS(CGL_GL_LOAD)
+#undef CGL_GL_LOAD
+    
+    const GLboolean mapRange = (number >= 30 || glfwExtensionSupported("GL_ARB_map_buffer_range")) && sGL.MapBufferRange && sGL.FlushMappedBufferRange;
+    const GLboolean sync = (number >= 32 || glfwExtensionSupported("GL_ARB_sync")) && sGL.FenceSync && sGL.ClientWaitSync && sGL.DeleteSync;
+    const GLboolean storage = (number >= 44 || glfwExtensionSupported("GL_ARB_buffer_storage")) && sGL.BufferStorage;
+    sStreamMode = !mapRange || !sync ? CGL_STREAM_SUBDATA : storage ? CGL_STREAM_PERSISTENT : CGL_STREAM_MAP_RANGE;
+}
+
+/**
+ * Gives the VBOs a segment per frame in flight and marks every segment out of date,
+ * returns an error message on failure
+ */
+static const char* _CGLlayoutStream()
+{
+    const int slots = sCellCount / CGL_TILE_CELLS;
+    for (int i = 0; i < CGL_STREAM_SEGMENTS; i++)
+    {
+        if (sStreamFences[i]) sGL.DeleteSync(sStreamFences[i]);
+        sStreamFences[i] = NULL;
+    }
+    for (int b = 0; b < CGL_FIXED_BUFFERS; b++)
+    {
+        const GLsizeiptr size = sCellCount * sBufferCellSizes[b] * CGL_STREAM_SEGMENTS;
+        if (sStreamMode == CGL_STREAM_PERSISTENT)
+        {
+            // Immutable storage cannot be resized, so the buffer is replaced. Deleting it unmaps it.
+            const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+            glDeleteBuffers(1, sBufferHandles[b]);
+            glGenBuffers(1, sBufferHandles[b]);
+            glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+            sGL.BufferStorage(GL_ARRAY_BUFFER, size, NULL, flags);
+            sStreamMaps[b] = sGL.MapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+            if (!sStreamMaps[b]) return "ERROR: Cannot map vbo.";
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+            glBufferData(GL_ARRAY_BUFFER, size, NULL, GL_STREAM_DRAW);
+        }
+    }
+    
+    free(sStreamDirtyMin);
+    free(sStreamDirtyMax);
+    free(sStreamBuilt);
+    sStreamDirtyMin = malloc(slots * CGL_STREAM_SEGMENTS * sizeof(int));
+    sStreamDirtyMax = malloc(slots * CGL_STREAM_SEGMENTS * sizeof(int));
+    sStreamBuilt = malloc(slots * CGL_STREAM_SEGMENTS * sizeof(GLboolean));
+    if (!sStreamDirtyMin || !sStreamDirtyMax || !sStreamBuilt) return "ERROR: Cannot allocate stream segments.";
+    for (int i = 0; i < slots * CGL_STREAM_SEGMENTS; i++)
+    {
+        sStreamDirtyMin[i] = 0;
+        sStreamDirtyMax[i] = CGL_TILE_CELLS;
+        sStreamBuilt[i] = GL_TRUE;
+    }
+    sStreamSegment = 0;
+    return 0;
+}
+
+/**
+ * Sets up the matrices and VBOs used by the fixed function renderer
+ */
+static void _CGLinitFixed()
+{
+    glMatrixMode(GL_TEXTURE);
+    glLoadIdentity();
+    glScalef(1.0f / (16 * sGlyphWidth), 1.0f / (16 * sGlyphHeight), 1.0f);
+    
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0.0f, sViewColumns * sGlyphWidth, sViewRows * sGlyphHeight, 0.0f, 0.0f, 1.0f);
+    
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+    
+    glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    
+    glGenBuffers(1, &sIndexHandle);
+    glGenBuffers(1, &sVertexHandle);
+    glGenBuffers(1, &sTextureCoordHandle);
+    glGenBuffers(1, &sFgColorHandle);
+    glGenBuffers(1, &sBgColorHandle);
+    
+    _CGLinitStream();
+    _CGLinitPool();
+}
+
+/**
+ * Sizes the VBOs for the tile slots of every console, returns an error message on failure
+ */
+static const char* _CGLlayoutFixed()
+{
+    const int cells = sCellCount;
+    size_t size;
+    
+    // Slots changed by the current update, in cells of the slot
+    free(sSlotDirtyMin);
+    free(sSlotDirtyMax);
+    free(sSlotBuilt);
+    sSlotDirtyMin = malloc(cells / CGL_TILE_CELLS * sizeof(int));
+    sSlotDirtyMax = calloc(cells / CGL_TILE_CELLS, sizeof(int));
+    sSlotBuilt = calloc(cells / CGL_TILE_CELLS, sizeof(GLboolean));
+    if (!sSlotDirtyMin || !sSlotDirtyMax || !sSlotBuilt) return "ERROR: Cannot allocate tile slots.";
+    for (int i = 0; i < cells / CGL_TILE_CELLS; i++) sSlotDirtyMin[i] = CGL_TILE_CELLS;
+    
+    // Create Index Buffer
+    size = cells * 6 * sizeof(GLuint);
+    free(sIndexBuffer);
+    sIndexBuffer = malloc(size);
+    if (!sIndexBuffer) return "ERROR: Cannot allocate index vbo.";
+    int len  = cells * 6;
+    for (int i = 0, v = 0; i < len; i += 6, v += 4)
+    {
+        sIndexBuffer[i + 0] = v + 0;
+        sIndexBuffer[i + 1] = v + 1;
+        sIndexBuffer[i + 2] = v + 2;
+        sIndexBuffer[i + 3] = v + 2;
+        sIndexBuffer[i + 4] = v + 3;
+        sIndexBuffer[i + 5] = v + 1;
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sIndexHandle);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, sIndexBuffer, GL_STATIC_DRAW);
+    
+    // Create Vertex Buffer, filled per tile by _CGLbuildTile
+    size = cells * 4 * 3 * sizeof(GLfloat);
+    free(sVertexBuffer);
+    sVertexBuffer = calloc(size, 1);
+    if (!sVertexBuffer) return "ERROR: Cannot allocate vertex vbo.";
+    
+    // Create Texture Coord Buffer
+    size = cells * 4 * 2 * sizeof(GLshort);
+    free(sTextureCoordBuffer);
+    sTextureCoordBuffer = calloc(size, 1);
+    if (!sTextureCoordBuffer) return "ERROR: Cannot allocate texture coordinate vbo.";
+    
+    // Create Foreground Color Buffer
+    size = cells * 4 * 4 * sizeof(GLubyte);
+    free(sFgColorBuffer);
+    sFgColorBuffer = malloc(size);
+    if (!sFgColorBuffer) return "ERROR: Cannot allocate foreground color vbo.";
+    memset(sFgColorBuffer, 255, size);
+    
+    // Create Background Color Buffer
+    size = cells * 4 * 4 * sizeof(GLubyte);
+    free(sBgColorBuffer);
+    sBgColorBuffer = calloc(size, 1);
+    if (!sBgColorBuffer) return "ERROR: Cannot allocate background color vbo.";
+    
+    // Streamed VBOs get their segments, the others a copy of the client side buffers
+    if (sStreamMode != CGL_STREAM_SUBDATA) return _CGLlayoutStream();
+    for (int b = 0; b < CGL_FIXED_BUFFERS; b++)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+        glBufferData(GL_ARRAY_BUFFER, cells * sBufferCellSizes[b], _CGLbufferSource(b), GL_DYNAMIC_DRAW);
+        sFrame.bytesUploaded += cells * sBufferCellSizes[b];
+    }
+    return 0;
+}
+
+/**
+ * Regenerates columns [_first, _last) of a row of sChars in the slot holding their tile
+ */
+static void _CGLrebuildTileCells(int _slot, int _row, int _first, int _last)
+{
+    const int local = (_row % CGL_TILE_ROWS) * CGL_TILE_COLUMNS + _first % CGL_TILE_COLUMNS;
+    const int slot = sCellBase / CGL_TILE_CELLS + _slot;
+    _CGLqueueRebuild(_row * sCharsWidth + _first, slot * CGL_TILE_CELLS + local, _last - _first, -1, 0);
+    if (local < sSlotDirtyMin[slot]) sSlotDirtyMin[slot] = local;
+    if (local + _last - _first > sSlotDirtyMax[slot]) sSlotDirtyMax[slot] = local + _last - _first;
+}
+
+/**
+ * Moves a tile of the current console into a slot and builds all of its cells there.
+ * Quads are placed with the rows rotated by sRowOrigin, cells past the grid are left empty.
+ */
+static void _CGLbuildTile(int _tile, int _slot)
+{
+    const int tileColumns = (sCharsWidth + CGL_TILE_COLUMNS - 1) / CGL_TILE_COLUMNS;
+    const int tileX = _tile % tileColumns * CGL_TILE_COLUMNS;
+    const int tileY = _tile / tileColumns * CGL_TILE_ROWS;
+    const int columns = sCharsWidth - tileX < CGL_TILE_COLUMNS ? sCharsWidth - tileX : CGL_TILE_COLUMNS;
+    const int rows = sCharsHeight - tileY < CGL_TILE_ROWS ? sCharsHeight - tileY : CGL_TILE_ROWS;
+    if (sSlotTiles[_slot] >= 0) sTileSlots[sSlotTiles[_slot]] = -1;
+    if (sTileSlots[_tile] >= 0) sSlotTiles[sTileSlots[_tile]] = -1;
+    sSlotTiles[_slot] = _tile;
+    sTileSlots[_tile] = _slot;
+    
+    const int slot = sCellBase / CGL_TILE_CELLS + _slot;
+    if (columns < CGL_TILE_COLUMNS || rows < CGL_TILE_ROWS)
+    {
+        memset(sVertexBuffer + slot * CGL_TILE_CELLS * 4 * 3, 0, CGL_TILE_CELLS * 4 * 3 * sizeof(GLfloat));
+    }
+    for (int y = 0; y < rows; y++)
+    {
+        const int screenRow = sPaneRow + (tileY + y - sRowOrigin + sCharsHeight) % sCharsHeight;
+        const int row = tileY + y;
+        _CGLqueueRebuild(row * sCharsWidth + tileX, slot * CGL_TILE_CELLS + y * CGL_TILE_COLUMNS, columns,
+                         (sPaneCol + tileX) * sGlyphWidth, screenRow * sGlyphHeight);
+    }
+    sSlotDirtyMin[slot] = 0;
+    sSlotDirtyMax[slot] = CGL_TILE_CELLS;
+    sSlotBuilt[slot] = GL_TRUE;
+}
+
+/**
+ * Builds the tiles of the current console that came into view and the dirty spans of the
+ * tiles that hold a slot. Spans in the other tiles are dropped, they are built when they get a slot.
+ */
+static void _CGLupdateFixed()
+{
+    const int tileColumns = (sCharsWidth + CGL_TILE_COLUMNS - 1) / CGL_TILE_COLUMNS;
+    const int tileRows = (sCharsHeight + CGL_TILE_ROWS - 1) / CGL_TILE_ROWS;
+    
+    // Scrolling by the row origin moves every quad, so every tile is built again
+    if (sVertexOrigin != sRowOrigin)
+    {
+        for (int i = 0; i < sSlotColumns * sSlotRows; i++) sSlotTiles[i] = -1;
+        for (int i = 0; i < tileColumns * tileRows; i++) sTileSlots[i] = -1;
+        sVertexOrigin = sRowOrigin;
+    }
+    
+    // Tile rows in view follow the screen rows, wrapping once at the row origin, so the slots
+    // of the tiles in view never collide. A tile in another slot is moved to its own one.
+    const int firstColumn = sViewCol / CGL_TILE_COLUMNS;
+    const int lastColumn = (sViewCol + sViewColumns - 1) / CGL_TILE_COLUMNS;
+    int lastTileRow = -1;
+    int slotRow = -1;
+    for (int y = sViewRow; y < sViewRow + sViewRows; y++)
+    {
+        const int tileRow = _CGLrow(y) / CGL_TILE_ROWS;
+        if (tileRow == lastTileRow) continue;
+        slotRow = slotRow < 0 ? tileRow : slotRow + 1;
+        lastTileRow = tileRow;
+        for (int x = firstColumn; x <= lastColumn; x++)
+        {
+            const int tile = tileRow * tileColumns + x;
+            const int slot = (slotRow % sSlotRows) * sSlotColumns + x % sSlotColumns;
+            if (sTileSlots[tile] != slot) _CGLbuildTile(tile, slot);
+        }
+    }
+    
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        if (sDirtyMin[y] >= sDirtyMax[y]) continue;
+        sFrame.cellsChanged += sDirtyMax[y] - sDirtyMin[y];
+        const int tileRow = y / CGL_TILE_ROWS;
+        for (int x = sDirtyMin[y]; x < sDirtyMax[y]; x = (x / CGL_TILE_COLUMNS + 1) * CGL_TILE_COLUMNS)
+        {
+            // Tiles built by this update already have their cells queued
+            const int slot = sTileSlots[tileRow * tileColumns + x / CGL_TILE_COLUMNS];
+            const int last = (x / CGL_TILE_COLUMNS + 1) * CGL_TILE_COLUMNS;
+            if (slot < 0 || sSlotBuilt[sCellBase / CGL_TILE_CELLS + slot]) continue;
+            _CGLrebuildTileCells(slot, y, x, last < sDirtyMax[y] ? last : sDirtyMax[y]);
+        }
+        sDirtyMin[y] = sCharsWidth;
+        sDirtyMax[y] = 0;
+    }
+}
+
+/**
+ * Passes the changed cells of slots to _write, merging neighbouring slots, and clears them
+ */
+static void _CGLmergeSlots(int* _dirtyMin, int* _dirtyMax, GLboolean* _built, void (*_write)(int _first, int _last, GLboolean _vertices))
+{
+    const int slots = sCellCount / CGL_TILE_CELLS;
+    int runFirst = 0;
+    int runLast = 0;
+    GLboolean runBuilt = GL_FALSE;
+    for (int i = 0; i <= slots; i++)
+    {
+        const GLboolean dirty = i < slots && _dirtyMin[i] < _dirtyMax[i];
+        if (dirty && runLast == i * CGL_TILE_CELLS + _dirtyMin[i] && runBuilt == _built[i])
+        {
+            runLast = i * CGL_TILE_CELLS + _dirtyMax[i];
+        }
+        else
+        {
+            if (runLast > runFirst) _write(runFirst, runLast, runBuilt);
+            runFirst = runLast = 0;
+            if (!dirty) continue;
+            runFirst = i * CGL_TILE_CELLS + _dirtyMin[i];
+            runLast = i * CGL_TILE_CELLS + _dirtyMax[i];
+            runBuilt = _built[i];
+        }
+        _dirtyMin[i] = CGL_TILE_CELLS;
+        _dirtyMax[i] = 0;
+        _built[i] = GL_FALSE;
+    }
+}
+
+/**
+ * Moves the draws to the next segment and brings it up to date with the cells changed since it was
+ * last written. The GPU finished with it frames ago unless it is CGL_STREAM_SEGMENTS frames behind.
+ */
+static void _CGLstreamSegment()
+{
+    const int slots = sCellCount / CGL_TILE_CELLS;
+    sStreamSegment = (sStreamSegment + 1) % CGL_STREAM_SEGMENTS;
+    GLsync fence = sStreamFences[sStreamSegment];
+    if (fence)
+    {
+        while (sGL.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED);
+        sGL.DeleteSync(fence);
+        sStreamFences[sStreamSegment] = NULL;
+    }
+    
+    // The fence already keeps the GPU off the segment, so the mapping skips the driver's own wait
+    if (sStreamMode == CGL_STREAM_MAP_RANGE)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT;
+        for (int b = 0; b < CGL_FIXED_BUFFERS; b++)
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+            sStreamMaps[b] = sGL.MapBufferRange(GL_ARRAY_BUFFER, 0, sCellCount * sBufferCellSizes[b] * CGL_STREAM_SEGMENTS, flags);
+        }
+    }
+    
+    const int segment = sStreamSegment * slots;
+    _CGLmergeSlots(sStreamDirtyMin + segment, sStreamDirtyMax + segment, sStreamBuilt + segment, _CGLstreamCells);
+    
+    if (sStreamMode == CGL_STREAM_MAP_RANGE)
+    {
+        for (int b = 0; b < CGL_FIXED_BUFFERS; b++)
+        {
+            if (!sStreamMaps[b]) continue;
+            glBindBuffer(GL_ARRAY_BUFFER, *sBufferHandles[b]);
+            glUnmapBuffer(GL_ARRAY_BUFFER);
+            sStreamMaps[b] = NULL;
+        }
+    }
+}
+
+/**
+ * Sends the slots every console changed to the VBOs, once their cells are rebuilt
+ */
+static void _CGLuploadFixed()
+{
+    if (sStreamMode == CGL_STREAM_SUBDATA)
+    {
+        _CGLmergeSlots(sSlotDirtyMin, sSlotDirtyMax, sSlotBuilt, _CGLuploadCells);
+        return;
+    }
+    
+    // Every segment falls behind by the slots changed this frame
+    const int slots = sCellCount / CGL_TILE_CELLS;
+    GLboolean changed = GL_FALSE;
+    for (int i = 0; i < slots; i++)
+    {
+        if (sSlotDirtyMin[i] >= sSlotDirtyMax[i]) continue;
+        for (int segment = i; segment < slots * CGL_STREAM_SEGMENTS; segment += slots)
+        {
+            if (sSlotDirtyMin[i] < sStreamDirtyMin[segment]) sStreamDirtyMin[segment] = sSlotDirtyMin[i];
+            if (sSlotDirtyMax[i] > sStreamDirtyMax[segment]) sStreamDirtyMax[segment] = sSlotDirtyMax[i];
+            sStreamBuilt[segment] |= sSlotBuilt[i];
+        }
+        sSlotDirtyMin[i] = CGL_TILE_CELLS;
+        sSlotDirtyMax[i] = 0;
+        sSlotBuilt[i] = GL_FALSE;
+        changed = GL_TRUE;
+    }
+    if (changed) _CGLstreamSegment();
+}
+
+/**
+ * Draws the slots of the main console panned to its view, then the slots of every other console
+ */
+static void _CGLdrawFixedCells()
+{
+    glPushMatrix();
+    glTranslatef(-sMainContext.ViewCol * sGlyphWidth, -sMainContext.ViewRow * sGlyphHeight, 0.0f);
+    glDrawElements(GL_TRIANGLES, sMainCells * 6, GL_UNSIGNED_INT, 0);
+    glPopMatrix();
+    if (sCellCount == sMainCells) return;
+    glDrawElements(GL_TRIANGLES, (sCellCount - sMainCells) * 6, GL_UNSIGNED_INT, (const GLvoid*)(sMainCells * 6 * sizeof(GLuint)));
+}
+
+/**
+ * Draws the background and foreground passes of every console, two draw calls each
+ */
+static void _CGLdrawFixed()
+{
+    
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_BLEND);
+    glDisable(GL_ALPHA_TEST);
+    
+    // Streamed VBOs are drawn from the segment written last
+    const GLsizeiptr segment = sStreamMode == CGL_STREAM_SUBDATA ? 0 : (GLsizeiptr)sStreamSegment * sCellCount;
+    
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, sIndexHandle);
+    glBindBuffer(GL_ARRAY_BUFFER, sVertexHandle);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(3, GL_FLOAT, 0, (const GLvoid*)(segment * sBufferCellSizes[0]));
+    
+    glBindBuffer(GL_ARRAY_BUFFER, sBgColorHandle);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, (const GLvoid*)(segment * sBufferCellSizes[3]));
+    
+    _CGLdrawFixedCells();
+    
+    // Glyph texels are fully opaque or transparent, so an alpha test replaces blending.
+    // Blinking cells have half alpha and fail the test while blinked out.
+    glEnable(GL_TEXTURE_2D);
+    glEnable(GL_ALPHA_TEST);
+    glAlphaFunc(GL_GREATER, sBlinkState ? 0.75f : 0.25f);
+    glBindTexture(GL_TEXTURE_2D, sFontTexture);
+    
+    glBindBuffer(GL_ARRAY_BUFFER, sTextureCoordHandle);
+    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+    glTexCoordPointer(2, GL_SHORT, 0, (const GLvoid*)(segment * sBufferCellSizes[1]));
+    
+    glBindBuffer(GL_ARRAY_BUFFER, sFgColorHandle);
+    glEnableClientState(GL_COLOR_ARRAY);
+    glColorPointer(4, GL_UNSIGNED_BYTE, 0, (const GLvoid*)(segment * sBufferCellSizes[2]));
+    
+    _CGLdrawFixedCells();
+    
+    if (sStreamMode == CGL_STREAM_SUBDATA) return;
+    if (sStreamFences[sStreamSegment]) sGL.DeleteSync(sStreamFences[sStreamSegment]);
+    sStreamFences[sStreamSegment] = sGL.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+/**
+ * Compiles a shader stage, returns 0 on failure
+ */
+static GLuint _CGLcompileShader(GLenum _type, const char* _source)
+{
+    GLint status;
+    GLuint shader = sGL.CreateShader(_type);
+    sGL.ShaderSource(shader, 1, &_source, NULL);
+    sGL.CompileShader(shader);
+    sGL.GetShaderiv(shader, GL_COMPILE_STATUS, &status);
+    if (!status)
+    {
+        sGL.DeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+/**
+ * Sends sColors to the palette texture, 1 KB
+ */
+static void _CGLuploadPalette()
+{
+    GLubyte rgba[256 * 4];
+    for (int i = 0; i < 256; i++)
+    {
+        rgba[i * 4 + 0] = sColors[i * 3 + 0];
+        rgba[i * 4 + 1] = sColors[i * 3 + 1];
+        rgba[i * 4 + 2] = sColors[i * 3 + 2];
+        rgba[i * 4 + 3] = 255;
+    }
+    sGL.ActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_2D, sPaletteTexture);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 256, 1, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+    sFrame.bytesUploaded += sizeof(rgba);
+    sGL.ActiveTexture(GL_TEXTURE0);
+}
+
+/**
+ * Deletes what a failed _CGLinitShader created, so the fixed renderer starts from default state.
+ * Returns GL_FALSE.
+ */
+static GLboolean _CGLfailShader(GLuint _vs, GLuint _fs)
+{
+    sGL.UseProgram(0);
+    if (_vs) sGL.DeleteShader(_vs);
+    if (_fs) sGL.DeleteShader(_fs);
+    if (sProgram) sGL.DeleteProgram(sProgram);
+    const GLuint textures[3] = {sGridTexture, sColorTexture, sPaletteTexture};
+    glDeleteTextures(3, textures);
+    if (sQuadHandle) glDeleteBuffers(1, &sQuadHandle);
+    sProgram = sGridTexture = sColorTexture = sPaletteTexture = sQuadHandle = 0;
+    sGL.ActiveTexture(GL_TEXTURE0);
+    return GL_FALSE;
+}
+
+/**
+ * Sets up the GL 3.x renderer that samples the grid directly as a texture.
+ * Returns GL_FALSE if the context cannot support it.
+ */
+static GLboolean _CGLinitShader()
+{
+    int major = 0;
+    const char* version = (const char*)glGetString(GL_VERSION);
+    if (!version || sscanf(version, "%d", &major) != 1 || major < 3) return GL_FALSE;
+    
+#define CGL_GL_LOAD(_type, _name) \
+    sGL._name = (_type)glfwGetProcAddress("gl" #_name); \
+    if (!sGL._name) return GL_FALSE;
+    CGL_GL_FUNCTIONS(CGL_GL_LOAD)
+#undef CGL_GL_LOAD
+    
+    GLuint vs = _CGLcompileShader(GL_VERTEX_SHADER, sVertexShader);
+    GLuint fs = _CGLcompileShader(GL_FRAGMENT_SHADER, sFragmentShader);
+    if (!vs || !fs) return _CGLfailShader(vs, fs);
+    
+    GLint status;
+    sProgram = sGL.CreateProgram();
+    sGL.AttachShader(sProgram, vs);
+    sGL.AttachShader(sProgram, fs);
+    sGL.BindAttribLocation(sProgram, 0, "aPosition");
+    sGL.BindAttribLocation(sProgram, 1, "aCell");
+    sGL.BindAttribLocation(sProgram, 2, "aPane");
+    sGL.LinkProgram(sProgram);
+    sGL.DeleteShader(vs);
+    sGL.DeleteShader(fs);
+    sGL.GetProgramiv(sProgram, GL_LINK_STATUS, &status);
+    if (!status) return _CGLfailShader(0, 0);
+    
+    sGL.UseProgram(sProgram);
+    sGL.Uniform1i(sGL.GetUniformLocation(sProgram, "uFont"), 0);
+    sGL.Uniform1i(sGL.GetUniformLocation(sProgram, "uGrid"), 1);
+    sGL.Uniform1i(sGL.GetUniformLocation(sProgram, "uColors"), 2);
+    sGL.Uniform1i(sGL.GetUniformLocation(sProgram, "uPalette"), 3);
+    sGL.Uniform2i(sGL.GetUniformLocation(sProgram, "uGlyphSize"), sGlyphWidth, sGlyphHeight);
+    sBlinkLocation = sGL.GetUniformLocation(sProgram, "uBlink");
+    sWideLocation = sGL.GetUniformLocation(sProgram, "uWide");
+    
+    // Errors left by earlier calls would otherwise be taken for texture setup failing
+    while (glGetError() != GL_NO_ERROR);
+    
+    // Grid and color plane textures, sized by _CGLlayoutShader
+    sGL.ActiveTexture(GL_TEXTURE1);
+    glGenTextures(1, &sGridTexture);
+    glBindTexture(GL_TEXTURE_2D, sGridTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    sGL.ActiveTexture(GL_TEXTURE2);
+    glGenTextures(1, &sColorTexture);
+    glBindTexture(GL_TEXTURE_2D, sColorTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    
+    // Palette texture, 256 RGBA texels
+    sGL.ActiveTexture(GL_TEXTURE3);
+    glGenTextures(1, &sPaletteTexture);
+    glBindTexture(GL_TEXTURE_2D, sPaletteTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 256, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    sGL.ActiveTexture(GL_TEXTURE0);
+    _CGLuploadPalette();
+    if (glGetError() != GL_NO_ERROR) return _CGLfailShader(0, 0);
+    
+    glGenBuffers(1, &sQuadHandle);
+    
+    return GL_TRUE;
+}
+
+/**
+ * Stacks the grids of every console in the grid and color textures and sizes the quad buffer,
+ * returns an error message on failure
+ */
+static const char* _CGLlayoutShader()
+{
+    static const GLushort noColors = 0;
+    sGL.ActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, sGridTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, sTextureWidth, sTextureHeight, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, NULL);
+    
+    // A single unused texel without the color plane
+    sGL.ActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, sColorTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+    if (sColorMode == CGL_COLORS_256) glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, sTextureWidth, sTextureHeight, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, NULL);
+    else glTexImage2D(GL_TEXTURE_2D, 0, GL_R16UI, 1, 1, 0, GL_RED_INTEGER, GL_UNSIGNED_SHORT, &noColors);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    sGL.ActiveTexture(GL_TEXTURE0);
+    
+    // Two triangles per console, filled by _CGLbuildQuad
+    const size_t size = sPaneCount * 6 * 8 * sizeof(GLfloat);
+    free(sQuadBuffer);
+    sQuadBuffer = calloc(size, 1);
+    if (!sQuadBuffer) return "ERROR: Cannot allocate quad vbo.";
+    glBindBuffer(GL_ARRAY_BUFFER, sQuadHandle);
+    glBufferData(GL_ARRAY_BUFFER, size, sQuadBuffer, GL_DYNAMIC_DRAW);
+    return 0;
+}
+
+/**
+ * Writes the two triangles of the current console: window position, cell position and where its grid is stacked
+ */
+static void _CGLbuildQuad()
+{
+    const float left = 2.0f * sPaneCol / sMainContext.ViewColumns - 1.0f;
+    const float right = 2.0f * (sPaneCol + sViewColumns) / sMainContext.ViewColumns - 1.0f;
+    const float top = 1.0f - 2.0f * sPaneRow / sMainContext.ViewRows;
+    const float bottom = 1.0f - 2.0f * (sPaneRow + sViewRows) / sMainContext.ViewRows;
+    const float first = sViewCol;
+    const float last = sViewCol + sViewColumns;
+    const float firstRow = sViewRow;
+    const float lastRow = sViewRow + sViewRows;
+    const GLfloat corners[6][4] = {
+        {left, top, first, firstRow},
+        {right, top, last, firstRow},
+        {left, bottom, first, lastRow},
+        {left, bottom, first, lastRow},
+        {right, top, last, firstRow},
+        {right, bottom, last, lastRow},
+    };
+    GLfloat* vertex = sQuadBuffer + sPaneIndex * 6 * 8;
+    for (int i = 0; i < 6; i++, vertex += 8)
+    {
+        memcpy(vertex, corners[i], sizeof(corners[i]));
+        vertex[4] = sTextureRow;
+        vertex[5] = sCharsHeight;
+        vertex[6] = sRowOrigin;
+        vertex[7] = sCharsWidth;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, sQuadHandle);
+    glBufferSubData(GL_ARRAY_BUFFER, sPaneIndex * 6 * 8 * sizeof(GLfloat), 6 * 8 * sizeof(GLfloat), sQuadBuffer + sPaneIndex * 6 * 8);
+    sFrame.bytesUploaded += 6 * 8 * sizeof(GLfloat);
+    sVertexOrigin = sRowOrigin;
+}
+
+/**
+ * Uploads a rectangle of the current grid, and of its color plane when in use
+ */
+static void _CGLuploadGridRect(int _x, int _y, int _width, int _height)
+{
+    const int offset = _y * sCharsWidth + _x;
+    sGL.ActiveTexture(GL_TEXTURE1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, _x, sTextureRow + _y, _width, _height, GL_RED_INTEGER, GL_UNSIGNED_SHORT, sChars + offset);
+    sFrame.bytesUploaded += _width * _height * sizeof(GLushort) * (sCellColors ? 2 : 1);
+    if (!sCellColors) return;
+    sGL.ActiveTexture(GL_TEXTURE2);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, _x, sTextureRow + _y, _width, _height, GL_RED_INTEGER, GL_UNSIGNED_SHORT, sCellColors + offset);
+}
+
+/**
+ * Uploads the dirty spans of the current grid, merging rows that share the same span
+ */
+static void _CGLupdateShader()
+{
+    // Scrolling by the row origin only changes the quad of the console
+    if (sVertexOrigin != sRowOrigin) _CGLbuildQuad();
+    
+    sGL.ActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, sGridTexture);
+    sGL.ActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, sColorTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, sCharsWidth);
+    int runY = 0;
+    int runRows = 0;
+    int runMin = 0;
+    int runMax = 0;
+    for (int y = 0; y <= sCharsHeight; y++)
+    {
+        const GLboolean dirty = y < sCharsHeight && sDirtyMin[y] < sDirtyMax[y];
+        if (runRows > 0 && (!dirty || sDirtyMin[y] != runMin || sDirtyMax[y] != runMax))
+        {
+            _CGLuploadGridRect(runMin, runY, runMax - runMin, runRows);
+            runRows = 0;
+        }
+        if (!dirty) continue;
+        sFrame.cellsChanged += sDirtyMax[y] - sDirtyMin[y];
+        if (runRows == 0)
+        {
+            runY = y;
+            runMin = sDirtyMin[y];
+            runMax = sDirtyMax[y];
+        }
+        runRows++;
+        sDirtyMin[y] = sCharsWidth;
+        sDirtyMax[y] = 0;
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    sGL.ActiveTexture(GL_TEXTURE0);
+}
+
+/**
+ * Draws every console with a single draw call, one quad each
+ */
+static void _CGLdrawShader()
+{
+    glDisable(GL_BLEND);
+    sGL.UseProgram(sProgram);
+    sGL.Uniform1i(sBlinkLocation, sBlinkState);
+    sGL.Uniform1i(sWideLocation, sColorMode == CGL_COLORS_256);
+    
+    glBindTexture(GL_TEXTURE_2D, sFontTexture);
+    sGL.ActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, sGridTexture);
+    sGL.ActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, sColorTexture);
+    sGL.ActiveTexture(GL_TEXTURE3);
+    glBindTexture(GL_TEXTURE_2D, sPaletteTexture);
+    sGL.ActiveTexture(GL_TEXTURE0);
+    
+    const GLsizei stride = 8 * sizeof(GLfloat);
+    glBindBuffer(GL_ARRAY_BUFFER, sQuadHandle);
+    sGL.EnableVertexAttribArray(0);
+    sGL.EnableVertexAttribArray(1);
+    sGL.EnableVertexAttribArray(2);
+    sGL.VertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, 0);
+    sGL.VertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(2 * sizeof(GLfloat)));
+    sGL.VertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, (const GLvoid*)(4 * sizeof(GLfloat)));
+    glDrawArrays(GL_TRIANGLES, 0, sPaneCount * 6);
+    sGL.DisableVertexAttribArray(2);
+    sGL.DisableVertexAttribArray(1);
+    sGL.DisableVertexAttribArray(0);
+}
+
+/**
+ * Packs a palette entry as an RGBA pixel in memory order
+ */
+static uint32_t _CGLpixel(int _index)
+{
+    const GLubyte rgba[4] = {sColors[_index * 3 + 0], sColors[_index * 3 + 1], sColors[_index * 3 + 2], 255};
+    uint32_t pixel;
+    memcpy(&pixel, rgba, sizeof(pixel));
+    return pixel;
+}
+
+/**
+ * Expands one 8 pixel font row into fg/bg pixels, leftmost pixel in bit 7
+ */
+static void _CGLexpandRow(uint32_t* _dst, GLubyte _bits, uint32_t _fg, uint32_t _bg)
+{
+#if defined(CGL_AVX2)
+    const __m256i select = _mm256_set_epi32(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+    const __m256i mask = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(_bits), select), select);
+    const __m256i pixels = _mm256_blendv_epi8(_mm256_set1_epi32(_bg), _mm256_set1_epi32(_fg), mask);
+    _mm256_storeu_si256((__m256i*)_dst, pixels);
+#elif defined(CGL_SSE2)
+    const __m128i selectLo = _mm_set_epi32(0x10, 0x20, 0x40, 0x80);
+    const __m128i selectHi = _mm_set_epi32(0x01, 0x02, 0x04, 0x08);
+    const __m128i bits = _mm_set1_epi32(_bits);
+    const __m128i fg = _mm_set1_epi32(_fg);
+    const __m128i bg = _mm_set1_epi32(_bg);
+    const __m128i maskLo = _mm_cmpeq_epi32(_mm_and_si128(bits, selectLo), selectLo);
+    const __m128i maskHi = _mm_cmpeq_epi32(_mm_and_si128(bits, selectHi), selectHi);
+    _mm_storeu_si128((__m128i*)_dst, _mm_or_si128(_mm_and_si128(maskLo, fg), _mm_andnot_si128(maskLo, bg)));
+    _mm_storeu_si128((__m128i*)(_dst + 4), _mm_or_si128(_mm_and_si128(maskHi, fg), _mm_andnot_si128(maskHi, bg)));
+#elif defined(CGL_NEON)
+    static const uint32_t selectLo[4] = {0x80, 0x40, 0x20, 0x10};
+    static const uint32_t selectHi[4] = {0x08, 0x04, 0x02, 0x01};
+    const uint32x4_t bits = vdupq_n_u32(_bits);
+    const uint32x4_t fg = vdupq_n_u32(_fg);
+    const uint32x4_t bg = vdupq_n_u32(_bg);
+    vst1q_u32(_dst, vbslq_u32(vtstq_u32(bits, vld1q_u32(selectLo)), fg, bg));
+    vst1q_u32(_dst + 4, vbslq_u32(vtstq_u32(bits, vld1q_u32(selectHi)), fg, bg));
+#else
+    for (int xx = 0; xx < 8; xx++)
+    {
+        _dst[xx] = ((_bits >> (7 - xx)) & 1) ? _fg : _bg;
+    }
+#endif
+}
+
+/**
+ * Clips columns [_first, _last) of a window row, in main console cells, to the view of a console
+ * and moves them to its grid. Returns the screen row of the console or -1 when they do not overlap.
+ */
+static int _CGLclipToPane(const CGLContext* _context, int _row, int* _first, int* _last)
+{
+    const int y = _row - _context->PaneRow;
+    if (y < 0 || y >= _context->ViewRows) return -1;
+    if (*_first < _context->PaneCol) *_first = _context->PaneCol;
+    if (*_last > _context->PaneCol + _context->ViewColumns) *_last = _context->PaneCol + _context->ViewColumns;
+    *_first += _context->ViewCol - _context->PaneCol;
+    *_last += _context->ViewCol - _context->PaneCol;
+    return *_first < *_last ? y + _context->ViewRow : -1;
+}
+
+/**
+ * Marks the cells of consoles drawn after the current one that overlap
+ * columns [_first, _last) of a window row, in main console cells
+ */
+static void _CGLexposePanes(int _row, int _first, int _last)
+{
+    for (CGLContext* context = sContext->next; context; context = context->next)
+    {
+        int first = _first;
+        int last = _last;
+        const int y = _CGLclipToPane(context, _row, &first, &last);
+        if (y < 0) continue;
+        const int row = (y + context->RowOrigin) % context->CharsHeight;
+        if (first < context->DirtyMin[row]) context->DirtyMin[row] = first;
+        if (last > context->DirtyMax[row]) context->DirtyMax[row] = last;
+    }
+}
+
+/**
+ * Marks the cells of the current console that a rotation by _shift rows
+ * filled with pixels of consoles drawn after it
+ */
+static void _CGLmarkCovered(int _shift)
+{
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        const int source = sPaneRow + (y + _shift) % sCharsHeight;
+        for (CGLContext* context = sContext->next; context; context = context->next)
+        {
+            int first = sPaneCol;
+            int last = sPaneCol + sCharsWidth;
+            if (_CGLclipToPane(context, source, &first, &last) < 0) continue;
+            const int offset = context->PaneCol - context->ViewCol - sPaneCol;
+            _CGLmarkDirty(_CGLrow(y), first + offset, last + offset);
+        }
+    }
+}
+
+/**
+ * Rasterizes columns [_first, _last) of a row of sChars into the software framebuffer
+ */
+static void _CGLrasterCells(int _row, int _first, int _last)
+{
+    const GLushort* src = sChars + _row * sCharsWidth;
+    const int screenRow = (_row - sRowOrigin + sCharsHeight) % sCharsHeight - sViewRow;
+    if (screenRow < 0 || screenRow >= sViewRows) return;
+    if (_first < sViewCol) _first = sViewCol;
+    if (_last > sViewCol + sViewColumns) _last = sViewCol + sViewColumns;
+    if (_first >= _last) return;
+    sFrame.cellsRebuilt += _last - _first;
+    const int rowBytes = (sGlyphWidth + 7) / 8;
+    const int tail = sGlyphWidth % 8; // Pixels in a partial last byte
+    for (int x = _first; x < _last; x++)
+    {
+        const GLushort d = src[x];
+        const GLubyte* glyph = sGlyphBits[d & 255];
+        const GLubyte blink = (d >> 15) & 1;
+        const GLushort colors = sCellColors ? sCellColors[_row * sCharsWidth + x] : _CGLattribColors(d);
+        const uint32_t bg = _CGLpixel(colors >> 8);
+        const uint32_t fg = (blink == 1 && sBlinkState) ? bg : _CGLpixel(colors & 255);
+        uint32_t* dst = sFramebuffer + ((sPaneRow + screenRow) * sGlyphHeight) * sFramebufferWidth + (sPaneCol + x - sViewCol) * sGlyphWidth;
+        for (int yy = 0; yy < sGlyphHeight; yy++, dst += sFramebufferWidth, glyph += rowBytes)
+        {
+            int b = 0;
+            for (; b < sGlyphWidth / 8; b++) _CGLexpandRow(dst + b * 8, glyph[b], fg, bg);
+            for (int xx = 0; xx < tail; xx++) dst[b * 8 + xx] = ((glyph[b] >> (7 - xx)) & 1) ? fg : bg;
+        }
+    }
+    _CGLexposePanes(sPaneRow + screenRow, sPaneCol + _first - sViewCol, sPaneCol + _last - sViewCol);
+}
+
+/**
+ * Rotates the pixels of the current console by the rows it was scrolled by moving sRowOrigin
+ */
+static void _CGLrotateSoftware()
+{
+    // Only a view of the whole grid can rotate its pixels, any other view shows different rows
+    if (sFramebufferOrigin != sRowOrigin && (sViewRows < sCharsHeight || sViewColumns < sCharsWidth))
+    {
+        _CGLmarkAllDirty();
+        sFramebufferOrigin = sRowOrigin;
+    }
+    else if (sFramebufferOrigin != sRowOrigin)
+    {
+        const int shift = (sRowOrigin - sFramebufferOrigin + sCharsHeight) % sCharsHeight;
+        const int lines = sCharsHeight * sGlyphHeight;
+        const int shiftLines = shift * sGlyphHeight;
+        const size_t lineSize = sCharsWidth * sGlyphWidth * sizeof(uint32_t);
+        uint32_t* base = sFramebuffer + sPaneRow * sGlyphHeight * sFramebufferWidth + sPaneCol * sGlyphWidth;
+        uint32_t* top = malloc(shiftLines * lineSize);
+        if (top)
+        {
+            for (int i = 0; i < shiftLines; i++) memcpy((char*)top + i * lineSize, base + i * sFramebufferWidth, lineSize);
+            for (int i = shiftLines; i < lines; i++) memcpy(base + (i - shiftLines) * sFramebufferWidth, base + i * sFramebufferWidth, lineSize);
+            for (int i = 0; i < shiftLines; i++) memcpy(base + (lines - shiftLines + i) * sFramebufferWidth, (char*)top + i * lineSize, lineSize);
+            free(top);
+        }
+        else
+        {
+            _CGLmarkAllDirty();
+        }
+        sFramebufferOrigin = sRowOrigin;
+        // The rotation moved whatever the consoles above this one had drawn
+        _CGLmarkCovered(shift);
+        for (int y = 0; y < sCharsHeight; y++) _CGLexposePanes(sPaneRow + y, sPaneCol, sPaneCol + sCharsWidth);
+    }
+}
+
+/**
+ * Rasterizes the dirty spans of the current console into the software framebuffer
+ */
+static void _CGLrasterSoftware()
+{
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        if (sDirtyMin[y] >= sDirtyMax[y]) continue;
+        sFrame.cellsChanged += sDirtyMax[y] - sDirtyMin[y];
+        _CGLrasterCells(y, sDirtyMin[y], sDirtyMax[y]);
+        sDirtyMin[y] = sCharsWidth;
+        sDirtyMax[y] = 0;
+    }
+}
+
+/**
+ * Calls a function with each console from _context on current in turn, in reverse draw order
+ */
+static void _CGLforEachContextReversed(CGLContext* _context, void (*_function)(void))
+{
+    if (!_context) return;
+    _CGLforEachContextReversed(_context->next, _function);
+    sContext = _context;
+    _CGLloadContext(_context);
+    _function();
+    _CGLstoreContext(_context);
+}
+
+/**
+ * Brings the software framebuffer up to date with every console
+ */
+static void _CGLupdateSoftware()
+{
+    // Rotations run top down so a rotation only moves pixels of consoles that are still to be
+    // rotated, and the exposed cells they mark stay where they are while everything is rasterized
+    CGLContext* current = sContext;
+    _CGLstoreContext(current);
+    _CGLforEachContextReversed(sContexts, _CGLrotateSoftware);
+    sContext = current;
+    _CGLloadContext(current);
+    _CGLforEachShown(_CGLrasterSoftware);
+    sDirty = GL_FALSE;
+}
+
+/**
+ * Writes all of a buffer to standard output
+ */
+static void _CGLtermWrite(const char* _data, size_t _size)
+{
+#if defined(_WIN32)
+    DWORD written;
+    WriteFile(GetStdHandle(STD_OUTPUT_HANDLE), _data, (DWORD)_size, &written, NULL);
+#else
+    while (_size > 0)
+    {
+        const ssize_t written = write(STDOUT_FILENO, _data, _size);
+        if (written < 0)
+        {
+            if (errno == EINTR) continue;
+            return;
+        }
+        _data += written;
+        _size -= written;
+    }
+#endif
+}
+
+/**
+ * Returns the codepoint the terminal draws a glyph with
+ */
+static uint32_t _CGLtermCodepoint(int _glyph)
+{
+    if (sGlyphCache && _glyph >= 128) return sSlotCodepoints[_glyph - 128];
+    return sTermCodepoints[_glyph];
+}
+
+/**
+ * Appends a codepoint as UTF-8, returns the number of bytes
+ */
+static int _CGLtermPutUTF8(char* _p, uint32_t _codepoint)
+{
+    if (_codepoint < 0x80)
+    {
+        _p[0] = (char)_codepoint;
+        return 1;
+    }
+    if (_codepoint < 0x800)
+    {
+        _p[0] = (char)(0xc0 | (_codepoint >> 6));
+        _p[1] = (char)(0x80 | (_codepoint & 0x3f));
+        return 2;
+    }
+    if (_codepoint < 0x10000)
+    {
+        _p[0] = (char)(0xe0 | (_codepoint >> 12));
+        _p[1] = (char)(0x80 | ((_codepoint >> 6) & 0x3f));
+        _p[2] = (char)(0x80 | (_codepoint & 0x3f));
+        return 3;
+    }
+    _p[0] = (char)(0xf0 | (_codepoint >> 18));
+    _p[1] = (char)(0x80 | ((_codepoint >> 12) & 0x3f));
+    _p[2] = (char)(0x80 | ((_codepoint >> 6) & 0x3f));
+    _p[3] = (char)(0x80 | (_codepoint & 0x3f));
+    return 4;
+}
+
+/**
+ * Returns the number of bytes the terminal needs to draw a screen cell
+ */
+static int _CGLtermCellBytes(uint32_t _cell)
+{
+    char utf8[4];
+    return _CGLtermPutUTF8(utf8, _CGLtermCodepoint(_cell & 255));
+}
+
+/**
+ * Returns GL_TRUE when a screen cell is drawn with the current SGR state
+ */
+static GLboolean _CGLtermSameAttrib(uint32_t _cell)
+{
+    return (int)((_cell >> 16) & 255) == sTermFg && (int)(_cell >> 24) == sTermBg && (int)((_cell >> 15) & 1) == sTermBlink;
+}
+
+/**
+ * Moves the cursor with the shortest sequence: rewriting the unchanged cells in between,
+ * a relative move or an absolute one
+ */
+static void _CGLtermMove(int _x, int _y)
+{
+    if (_x == sTermX && _y == sTermY) return;
+    char* p = sTermBuffer + sTermLength;
+    if (_y == sTermY && sTermX >= 0 && _x > sTermX)
+    {
+        const int gap = _x - sTermX;
+        const int moveBytes = gap < 10 ? 4 : gap < 100 ? 5 : 6;
+        const uint32_t* shadow = sTermShadow + _y * sMainContext.ViewColumns;
+        int bytes = 0;
+        for (int x = sTermX; x < _x && bytes <= moveBytes; x++)
+        {
+            if (shadow[x] == CGL_TERM_UNKNOWN || !_CGLtermSameAttrib(shadow[x])) bytes = moveBytes + 1;
+            else bytes += _CGLtermCellBytes(shadow[x]);
+        }
+        if (bytes <= moveBytes)
+        {
+            for (int x = sTermX; x < _x; x++) p += _CGLtermPutUTF8(p, _CGLtermCodepoint(shadow[x] & 255));
+        }
+        else
+        {
+            p += sprintf(p, "\x1b[%dC", gap);
+        }
+    }
+    else if (_x == 0 && sTermY >= 0 && _y == sTermY + 1)
+    {
+        *p++ = '\r';
+        *p++ = '\n';
+    }
+    else
+    {
+        p += sprintf(p, "\x1b[%d;%dH", _y + 1, _x + 1);
+    }
+    sTermLength = p - sTermBuffer;
+    sTermX = _x;
+    sTermY = _y;
+}
+
+/**
+ * Appends the SGR parameter selecting a color, bright colors use the aixterm codes
+ */
+static char* _CGLtermColor(char* _p, int _color, int _base, int _brightBase, int _extended)
+{
+    if (_color < 8) return _p + sprintf(_p, "%d;", _base + _color);
+    if (_color < 16) return _p + sprintf(_p, "%d;", _brightBase + _color - 8);
+    return _p + sprintf(_p, "%d;5;%d;", _extended, _color);
+}
+
+/**
+ * Changes only the SGR attributes that differ from the current state
+ */
+static void _CGLtermAttrib(uint32_t _cell)
+{
+    const int fg = (_cell >> 16) & 255;
+    const int bg = _cell >> 24;
+    const int blink = (_cell >> 15) & 1;
+    if (fg == sTermFg && bg == sTermBg && blink == sTermBlink) return;
+    char* p = sTermBuffer + sTermLength;
+    *p++ = '\x1b';
+    *p++ = '[';
+    if (fg != sTermFg) p = _CGLtermColor(p, fg, 30, 90, 38);
+    if (bg != sTermBg) p = _CGLtermColor(p, bg, 40, 100, 48);
+    if (blink != sTermBlink) p += sprintf(p, "%d;", blink ? 5 : 25);
+    p[-1] = 'm';
+    sTermLength = p - sTermBuffer;
+    sTermFg = fg;
+    sTermBg = bg;
+    sTermBlink = blink;
+}
+
+/**
+ * Composes the dirty spans of the current console into the terminal screen
+ */
+static void _CGLcomposeTerminal()
+{
+    if (sFramebufferOrigin != sRowOrigin)
+    {
+        // The terminal scrolls a main console it shows whole itself, the diff then only redraws what moved under it
+        if (sContext == &sMainContext && sViewRows == sCharsHeight && sViewColumns == sCharsWidth)
+        {
+            const int shift = (sRowOrigin - sFramebufferOrigin + sCharsHeight) % sCharsHeight;
+            const int up = shift <= sCharsHeight / 2;
+            const int lines = up ? shift : sCharsHeight - shift;
+            const int kept = (sCharsHeight - lines) * sCharsWidth;
+            uint32_t* blank = sTermShadow + (up ? kept : 0);
+            if (up) memmove(sTermShadow, sTermShadow + lines * sCharsWidth, kept * sizeof(uint32_t));
+            else memmove(sTermShadow + lines * sCharsWidth, sTermShadow, kept * sizeof(uint32_t));
+            for (int i = 0; i < lines * sCharsWidth; i++) blank[i] = CGL_TERM_UNKNOWN;
+            sTermLength += sprintf(sTermBuffer + sTermLength, "\x1b[%d%c", lines, up ? 'S' : 'T');
+        }
+        _CGLmarkAllDirty();
+        sFramebufferOrigin = sRowOrigin;
+    }
+    
+    const int width = sMainContext.ViewColumns;
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        if (sDirtyMin[y] >= sDirtyMax[y]) continue;
+        sFrame.cellsChanged += sDirtyMax[y] - sDirtyMin[y];
+        const int first = sDirtyMin[y] > sViewCol ? sDirtyMin[y] : sViewCol;
+        const int last = sDirtyMax[y] < sViewCol + sViewColumns ? sDirtyMax[y] : sViewCol + sViewColumns;
+        const int viewRow = (y - sRowOrigin + sCharsHeight) % sCharsHeight - sViewRow;
+        sDirtyMin[y] = sCharsWidth;
+        sDirtyMax[y] = 0;
+        if (viewRow < 0 || viewRow >= sViewRows || first >= last) continue;
+        sFrame.cellsRebuilt += last - first;
+        const int screenRow = sPaneRow + viewRow;
+        const int screenCol = sPaneCol - sViewCol;
+        const GLushort* src = sChars + y * sCharsWidth;
+        uint32_t* dst = sTermScreen + screenRow * width + screenCol;
+        for (int x = first; x < last; x++)
+        {
+            const GLushort colors = sCellColors ? sCellColors[y * sCharsWidth + x] : _CGLattribColors(src[x]);
+            dst[x] = src[x] | (uint32_t)colors << 16;
+        }
+        if (screenCol + first < sTermDirtyMin[screenRow]) sTermDirtyMin[screenRow] = screenCol + first;
+        if (screenCol + last > sTermDirtyMax[screenRow]) sTermDirtyMax[screenRow] = screenCol + last;
+        _CGLexposePanes(screenRow, screenCol + first, screenCol + last);
+    }
+}
+
+/**
+ * Writes the cells that differ from what the terminal shows with a single write
+ */
+static void _CGLupdateTerminal()
+{
+    _CGLforEachShown(_CGLcomposeTerminal);
+    _CGLphase(CGL_PHASE_UPLOAD);
+    
+    const int width = sMainContext.ViewColumns;
+    const int height = sMainContext.ViewRows;
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = sTermDirtyMin[y]; x < sTermDirtyMax[y]; x++)
+        {
+            const uint32_t cell = sTermScreen[y * width + x];
+            if (cell == sTermShadow[y * width + x]) continue;
+            _CGLtermMove(x, y);
+            _CGLtermAttrib(cell);
+            sTermLength += _CGLtermPutUTF8(sTermBuffer + sTermLength, _CGLtermCodepoint(cell & 255));
+            sTermShadow[y * width + x] = cell;
+            // Writing the last column leaves the cursor waiting to wrap
+            sTermX = x + 1 < width ? x + 1 : -1;
+        }
+        sTermDirtyMin[y] = width;
+        sTermDirtyMax[y] = 0;
+    }
+    
+    if (sTermLength > 0) _CGLtermWrite(sTermBuffer, sTermLength);
+    sFrame.bytesUploaded += sTermLength;
+    sTermLength = 0;
+    sDirty = GL_FALSE;
+}
+
+/**
+ * Allocates the terminal screens and switches the terminal to a cleared alternate screen,
+ * returns an error message on failure
+ */
+static const char* _CGLinitTerminal()
+{
+    const int area = sViewColumns * sViewRows;
+    sTermScreen = malloc(area * sizeof(uint32_t));
+    sTermShadow = malloc(area * sizeof(uint32_t));
+    sTermDirtyMin = malloc(sViewRows * sizeof(int));
+    sTermDirtyMax = calloc(sViewRows, sizeof(int));
+    sTermBuffer = malloc(area * CGL_TERM_CELL_BYTES + 64);
+    if (!sTermScreen || !sTermShadow || !sTermDirtyMin || !sTermDirtyMax || !sTermBuffer) return "ERROR: Cannot allocate terminal screen.";
+    for (int i = 0; i < area; i++) sTermShadow[i] = CGL_TERM_UNKNOWN;
+    for (int y = 0; y < sViewRows; y++) sTermDirtyMin[y] = sViewColumns;
+    
+    // Glyphs are written as the lowest codepoint the font maps to them, control codes as '?'
+    for (int i = 0; i < 256; i++) sTermCodepoints[i] = sFontMap ? '?' : (uint32_t)i;
+    for (int i = sFontMapCount - 1; sFontMap && i >= 0; i--)
+    {
+        if (sFontMap[i].glyph < 256) sTermCodepoints[sFontMap[i].glyph] = sFontMap[i].codepoint;
+    }
+    for (int i = 0; i < 256; i++)
+    {
+        if (sTermCodepoints[i] < 0x20 || sTermCodepoints[i] == 0x7f) sTermCodepoints[i] = sTermCodepoints[i] ? '?' : ' ';
+    }
+    
+    sTermX = sTermY = -1;
+    sTermFg = sTermBg = sTermBlink = -1;
+    sTermLength = sprintf(sTermBuffer, "\x1b[?1049h\x1b[?25l\x1b[0m\x1b[2J\x1b[1;%dr", sViewRows);
+    return 0;
+}
+
+/**
+ * Restores the terminal and releases the terminal screens
+ */
+static void _CGLfreeTerminal()
+{
+    if (sTermBuffer)
+    {
+        static const char restore[] = "\x1b[r\x1b[0m\x1b[?25h\x1b[?1049l";
+        _CGLtermWrite(restore, sizeof(restore) - 1);
+    }
+    free(sTermScreen);
+    free(sTermShadow);
+    free(sTermDirtyMin);
+    free(sTermDirtyMax);
+    free(sTermBuffer);
+    sTermScreen = sTermShadow = NULL;
+    sTermDirtyMin = sTermDirtyMax = NULL;
+    sTermBuffer = NULL;
+}
+
+/**
+ * Returns the number of blinking cells in every console
+ */
+static int _CGLblinkTotal()
+{
+    _CGLstoreContext(sContext);
+    int total = 0;
+    for (const CGLContext* context = sContexts; context; context = context->next)
+    {
+        total += context->BlinkCount;
+        for (const CGLContext* layer = context->Layers; layer; layer = layer->next)
+        {
+            if (layer->visible) total += layer->BlinkCount;
+        }
+    }
+    return total;
+}
+
+/**
+ * Marks the blinking cells of the current console
+ */
+static void _CGLmarkBlinks()
+{
+    for (const CGLContext* layer = sLayers; layer; layer = layer->next)
+    {
+        if (layer->visible && layer->BlinkCount > 0) _CGLmarkUnder(layer, sRowOrigin);
+    }
+    if (sBlinkCount == 0) return;
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        if (sRowBlinks[y] == 0) continue;
+        for (int x = 0; x < sCharsWidth; x++)
+        {
+            const GLushort d = sChars[y * sCharsWidth + x];
+            const GLubyte blink = (d >> 15) & 1;
+            if (blink == 1) _CGLmarkDirty(y, x, x + 1);
+        }
+    }
+}
+
+/**
+ * Toggles blinking once the deadline passes, marking blinking cells when the renderer bakes them.
+ * Returns GL_TRUE when the screen has to be redrawn.
+ */
+static GLboolean _CGLblinkTick(double _now)
+{
+    if (_now < sNextBlink) return GL_FALSE;
+    sBlinkState = !sBlinkState;
+    sNextBlink = _now + BLINK_PERIOD;
+    if (_CGLblinkTotal() == 0) return GL_FALSE;
+    // The GL renderers toggle blinking with a uniform or alpha test, only the software backend bakes it
+    if (sBackend == CGL_BACKEND_SOFTWARE) _CGLforEachContext(_CGLmarkBlinks);
+    return GL_TRUE;
+}
+
+/**
+ * Returns the time the main loop may wait until, given the next frame deadline.
+ * Returns a negative time when only an event can wake the loop.
+ */
+static double _CGLwaitDeadline(double _nextFrame)
+{
+    if (!sIdle) return sFrameRate > 0 ? _nextFrame : 0.0;
+    // Idle loops only wake for input, posted batches, blinking, playback or the frame rate
+    double deadline = sNextBlink;
+    if (_CGLblinkTotal() == 0) deadline = sFrameRate > 0 ? _nextFrame : -1.0;
+    else if (sFrameRate > 0 && _nextFrame < sNextBlink) deadline = _nextFrame;
+    if (sPlayData && (deadline < 0.0 || sPlayNext < deadline)) deadline = sPlayNext;
+    return deadline;
+}
+
+/**
+ * Takes every submitted batch and applies them in submission order
+ */
+static void _CGLapplyBatches()
+{
+    CGLbatch* batch = atomic_exchange_explicit(&sPendingBatches, NULL, memory_order_acquire);
+    if (!batch) return;
+    
+    // Reverse the stack into submission order
+    CGLbatch* ordered = NULL;
+    while (batch)
+    {
+        CGLbatch* next = batch->next;
+        batch->next = ordered;
+        ordered = batch;
+        batch = next;
+    }
+    
+    // Batches always draw to the main console
+    CGLContext* current = sContext;
+    CGLmakeCurrent(&sMainContext);
+    while (ordered)
+    {
+        CGLbatch* next = ordered->next;
+        size_t offset = 0;
+        while (offset < ordered->size && sChars)
+        {
+            CGLbatchRecord record;
+            memcpy(&record, ordered->data + offset, sizeof(record));
+            offset += sizeof(record);
+            CGLblit((const uint16_t*)(ordered->data + offset), record.col, record.row, record.width, record.height, record.width);
+            offset += ((record.width * record.height + 1) & ~1) * sizeof(uint16_t);
+        }
+        CGLbatchDestroy(ordered);
+        ordered = next;
+    }
+    CGLmakeCurrent(current);
+}
+
+/**
+ * Sets a hint for the next call to CGLmain
+ */
+void CGLhint(int _hint, int _value)
+{
+    switch (_hint)
+    {
+        case CGL_HINT_RENDERER:
+        {
+            sRenderer = _value;
+            break;
+        }
+            
+        case CGL_HINT_BACKEND:
+        {
+            sBackend = _value;
+            break;
+        }
+            
+        case CGL_HINT_SWAP_INTERVAL:
+        {
+            sSwapInterval = _value;
+            break;
+        }
+            
+        case CGL_HINT_FRAME_RATE:
+        {
+            sFrameRate = _value;
+            break;
+        }
+            
+        case CGL_HINT_IDLE:
+        {
+            sIdle = _value != 0;
+            break;
+        }
+            
+        case CGL_HINT_COLORS:
+        {
+            sColorMode = _value;
+            break;
+        }
+            
+        case CGL_HINT_GLYPH_CACHE:
+        {
+            sGlyphCache = _value != 0;
+            break;
+        }
+            
+        case CGL_HINT_VIEW_COLUMNS:
+        {
+            sViewColumnsHint = _value;
+            break;
+        }
+            
+        case CGL_HINT_VIEW_ROWS:
+        {
+            sViewRowsHint = _value;
+            break;
+        }
+            
+        case CGL_HINT_THREADS:
+        {
+            sThreadsHint = _value;
+            break;
+        }
+            
+        case CGL_HINT_INPUT_DELAY:
+        {
+            sInputDelay = _value;
+            break;
+        }
+    }
+}
+
+/**
+ * Maps a whole file read only, returns NULL on failure
+ */
+static const unsigned char* _CGLmapFile(const char* _path, size_t* _size)
+{
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(_path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return NULL;
+    LARGE_INTEGER size;
+    HANDLE mapping = NULL;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) return NULL;
+    const unsigned char* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    *_size = (size_t)size.QuadPart;
+    return data;
+#else
+    const int file = open(_path, O_RDONLY);
+    if (file < 0) return NULL;
+    struct stat st;
+    void* data = MAP_FAILED;
+    if (fstat(file, &st) == 0 && st.st_size > 0) data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if (data == MAP_FAILED) return NULL;
+    *_size = st.st_size;
+    return data;
+#endif
+}
+
+/**
+ * Unmaps a file mapped by _CGLmapFile
+ */
+static void _CGLunmapFile(const unsigned char* _data, size_t _size)
+{
+#if defined(_WIN32)
+    (void)_size;
+    UnmapViewOfFile(_data);
+#else
+    munmap((void*)_data, _size);
+#endif
+}
+
+/**
+ * Orders font map entries by codepoint
+ */
+static int _CGLcompareMapEntries(const void* _a, const void* _b)
+{
+    const uint32_t a = ((const CGLfontMapEntry*)_a)->codepoint;
+    const uint32_t b = ((const CGLfontMapEntry*)_b)->codepoint;
+    return a < b ? -1 : a > b;
+}
+
+/**
+ * Returns the glyph of the current font for a codepoint, or -1 when it has none
+ */
+static int _CGLfontGlyph(uint32_t _codepoint)
+{
+    if (!sFontMap) return _codepoint < (uint32_t)sGlyphCount ? (int)_codepoint : -1;
+    int low = 0;
+    int high = sFontMapCount - 1;
+    while (low <= high)
+    {
+        const int mid = (low + high) / 2;
+        if (sFontMap[mid].codepoint == _codepoint) return sFontMap[mid].glyph;
+        if (sFontMap[mid].codepoint < _codepoint) low = mid + 1;
+        else high = mid - 1;
+    }
+    return -1;
+}
+
+/**
+ * Selects the built in CP437 font
+ */
+static void _CGLsetDefaultFont()
+{
+    static CGLfontMapEntry map[256];
+    if (!map[255].codepoint)
+    {
+        for (int i = 0; i < 256; i++)
+        {
+            map[i].codepoint = sCP437[i];
+            map[i].glyph = i;
+        }
+        qsort(map, 256, sizeof(CGLfontMapEntry), _CGLcompareMapEntries);
+    }
+    free(sLoadedFont);
+    free(sLoadedMap);
+    sLoadedFont = NULL;
+    sLoadedMap = NULL;
+    sFontBits = font_data;
+    sFontAtlas = font_atlas;
+    sFontMap = map;
+    sFontMapCount = 256;
+    sGlyphCount = 256;
+    sGlyphWidth = sGlyphHeight = 8;
+}
+
+/**
+ * Allocates zeroed bits for _count glyphs of _width x _height followed by an atlas of 256 glyphs
+ */
+static GLubyte* _CGLallocFont(int _width, int _height, int _count)
+{
+    if (_width < 1 || _width > 32 || _height < 1 || _height > 32) return NULL;
+    if (_count < 1 || _count > 65536) return NULL;
+    const size_t bitsSize = (size_t)_count * _height * ((_width + 7) / 8);
+    return calloc(bitsSize + 256 * _width * _height, 1);
+}
+
+/**
+ * Expands the first 256 glyphs of a font from _CGLallocFont into its atlas and makes it current.
+ * Takes ownership of the font and of _map, which may be NULL when codepoints equal glyphs.
+ */
+static void _CGLsetFont(GLubyte* _font, int _width, int _height, int _count, CGLfontMapEntry* _map, int _mapCount)
+{
+    const int rowBytes = (_width + 7) / 8;
+    GLubyte* atlas = _font + (size_t)_count * _height * rowBytes;
+    for (int glyph = 0; glyph < 256 && glyph < _count; glyph++)
+    {
+        const GLubyte* bits = _font + glyph * _height * rowBytes;
+        GLubyte* dst = atlas + (glyph / 16) * _height * 16 * _width + (glyph % 16) * _width;
+        for (int yy = 0; yy < _height; yy++, bits += rowBytes, dst += 16 * _width)
+        {
+            for (int xx = 0; xx < _width; xx++)
+            {
+                dst[xx] = ((bits[xx / 8] >> (7 - xx % 8)) & 1) * 255;
+            }
+        }
+    }
+    if (_map) qsort(_map, _mapCount, sizeof(CGLfontMapEntry), _CGLcompareMapEntries);
+    
+    _CGLsetDefaultFont();
+    sLoadedFont = _font;
+    sLoadedMap = _map;
+    sFontBits = _font;
+    sFontAtlas = atlas;
+    sFontMap = _map;
+    sFontMapCount = _map ? _mapCount : 0;
+    sGlyphCount = _count;
+    sGlyphWidth = _width;
+    sGlyphHeight = _height;
+}
+
+/**
+ * Reads a little endian 32-bit value
+ */
+static uint32_t _CGLread32(const unsigned char* _data)
+{
+    return _data[0] | (_data[1] << 8) | (_data[2] << 16) | ((uint32_t)_data[3] << 24);
+}
+
+/**
+ * Decodes one UTF-8 sequence at _p, returns its length or 0 when it is invalid or truncated
+ */
+static int _CGLdecodeUTF8(const unsigned char* _p, const unsigned char* _end, uint32_t* _codepoint)
+{
+    const unsigned char c = *_p;
+    int length = c < 0x80 ? 1 : c < 0xc2 ? 0 : c < 0xe0 ? 2 : c < 0xf0 ? 3 : c < 0xf5 ? 4 : 0;
+    if (length == 0 || _end - _p < length) return 0;
+    uint32_t codepoint = length == 1 ? c : c & (0x7f >> length);
+    for (int i = 1; i < length; i++)
+    {
+        if ((_p[i] & 0xc0) != 0x80) return 0;
+        codepoint = (codepoint << 6) | (_p[i] & 0x3f);
+    }
+    // Reject overlong forms, surrogates and codepoints past U+10FFFF
+    if ((length == 3 && codepoint < 0x800) || (length == 4 && codepoint < 0x10000)) return 0;
+    if ((codepoint >= 0xd800 && codepoint < 0xe000) || codepoint > 0x10ffff) return 0;
+    *_codepoint = codepoint;
+    return length;
+}
+
+/**
+ * Reads the unicode table following the glyphs of a PSF font, skipping multi codepoint sequences.
+ * Returns the number of entries, 0 when there are none.
+ */
+static int _CGLloadPSFTable(const unsigned char* _p, const unsigned char* _end, GLboolean _utf8, int _count, CGLfontMapEntry** _map)
+{
+    int capacity = _count * 2;
+    int entries = 0;
+    CGLfontMapEntry* map = malloc(capacity * sizeof(CGLfontMapEntry));
+    if (!map) return 0;
+    for (int glyph = 0; glyph < _count && _p < _end; glyph++)
+    {
+        GLboolean sequence = GL_FALSE;
+        while (_p < _end)
+        {
+            uint32_t codepoint;
+            if (_utf8)
+            {
+                if (*_p == 0xff) { _p++; break; }
+                if (*_p == 0xfe) { _p++; sequence = GL_TRUE; continue; }
+                const int length = _CGLdecodeUTF8(_p, _end, &codepoint);
+                _p += length ? length : 1;
+                if (!length) continue;
+            }
+            else
+            {
+                if (_end - _p < 2) { _p = _end; break; }
+                codepoint = _p[0] | (_p[1] << 8);
+                _p += 2;
+                if (codepoint == 0xffff) break;
+                if (codepoint == 0xfffe) { sequence = GL_TRUE; continue; }
+            }
+            if (sequence) continue;
+            if (entries == capacity)
+            {
+                CGLfontMapEntry* grown = realloc(map, capacity * 2 * sizeof(CGLfontMapEntry));
+                if (!grown) break;
+                map = grown;
+                capacity *= 2;
+            }
+            map[entries].codepoint = codepoint;
+            map[entries++].glyph = glyph;
+        }
+    }
+    if (entries == 0) free(map);
+    else *_map = map;
+    return entries;
+}
+
+/**
+ * Loads a PSF1 or PSF2 font and its unicode table
+ */
+static const char* _CGLloadPSF(const unsigned char* _data, size_t _size)
+{
+    int width, height, count;
+    size_t offset, glyphSize;
+    GLboolean hasTable;
+    if (_data[0] == 0x36)
+    {
+        width = 8;
+        height = _data[3];
+        count = (_data[2] & 1) ? 512 : 256;
+        hasTable = (_data[2] & 2) != 0;
+        offset = 4;
+        glyphSize = height;
+    }
+    else
+    {
+        if (_size < 32) return "ERROR: Truncated PSF2 header.";
+        offset = _CGLread32(_data + 8);
+        hasTable = (_CGLread32(_data + 12) & 1) != 0;
+        count = (int)_CGLread32(_data + 16);
+        glyphSize = _CGLread32(_data + 20);
+        height = (int)_CGLread32(_data + 24);
+        width = (int)_CGLread32(_data + 28);
+    }
+    
+    GLubyte* font = _CGLallocFont(width, height, count);
+    if (!font) return "ERROR: Unsupported font size.";
+    if (glyphSize != (size_t)height * ((width + 7) / 8) || offset > _size || (_size - offset) / glyphSize < (size_t)count)
+    {
+        free(font);
+        return "ERROR: Truncated or unsupported font file.";
+    }
+    memcpy(font, _data + offset, count * glyphSize);
+    
+    CGLfontMapEntry* map = NULL;
+    int mapCount = 0;
+    if (hasTable) mapCount = _CGLloadPSFTable(_data + offset + count * glyphSize, _data + _size, _data[0] != 0x36, count, &map);
+    _CGLsetFont(font, width, height, count, map, mapCount);
+    return 0;
+}
+
+/**
+ * Copies the next line of a BDF file into _line, truncating long lines
+ */
+static const unsigned char* _CGLbdfLine(const unsigned char* _p, const unsigned char* _end, char* _line, size_t _capacity)
+{
+    size_t length = 0;
+    while (_p < _end && *_p != '\n')
+    {
+        if (length + 1 < _capacity && *_p != '\r') _line[length++] = *_p;
+        _p++;
+    }
+    _line[length] = 0;
+    return _p < _end ? _p + 1 : _p;
+}
+
+/**
+ * Loads a BDF font, placing glyphs in the font bounding box.
+ * Encodings 0-255 keep their glyph number, the others follow in file order.
+ */
+static const char* _CGLloadBDF(const unsigned char* _data, size_t _size)
+{
+    const unsigned char* p = _data;
+    const unsigned char* end = _data + _size;
+    GLubyte* font = NULL;
+    CGLfontMapEntry* map = NULL;
+    int width = 0, height = 0, originX = 0, originY = 0;
+    int chars = 0, count = 256, mapCount = 0;
+    int glyph = -1, boxWidth = 0, boxHeight = 0, boxX = 0, boxY = 0;
+    int row = -1; // Bitmap row being read, -1 outside BITMAP
+    char line[128];
+    while (p < end)
+    {
+        p = _CGLbdfLine(p, end, line, sizeof(line));
+        if (row >= 0)
+        {
+            if (strncmp(line, "ENDCHAR", 7) == 0)
+            {
+                row = -1;
+                continue;
+            }
+            // Glyph rows are hex, MSB first, positioned by BBX relative to the baseline
+            const int y = height + originY - boxY - boxHeight + row++;
+            if (glyph < 0 || y < 0 || y >= height) continue;
+            GLubyte* dst = font + (glyph * height + y) * ((width + 7) / 8);
+            for (int xx = 0; xx < boxWidth && line[xx / 4]; xx++)
+            {
+                const char c = line[xx / 4];
+                const int nibble = c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+                const int x = boxX - originX + xx;
+                if (x >= 0 && x < width && ((nibble >> (3 - xx % 4)) & 1)) dst[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        else if (!font)
+        {
+            if (sscanf(line, "FONTBOUNDINGBOX %d %d %d %d", &width, &height, &originX, &originY) == 4) continue;
+            if (sscanf(line, "CHARS %d", &chars) != 1) continue;
+            if (chars < 0 || chars > 65536 - 256) break;
+            font = _CGLallocFont(width, height, 256 + chars);
+            map = malloc((chars > 0 ? chars : 1) * sizeof(CGLfontMapEntry));
+            if (!font || !map) break;
+        }
+        else if (strncmp(line, "STARTCHAR", 9) == 0) glyph = -1;
+        else if (sscanf(line, "ENCODING %d", &glyph) == 1)
+        {
+            if (glyph < 0 || mapCount == chars) glyph = -1;
+            else
+            {
+                map[mapCount].codepoint = glyph;
+                if (glyph > 255) glyph = count++;
+                map[mapCount++].glyph = glyph;
+            }
+        }
+        else if (sscanf(line, "BBX %d %d %d %d", &boxWidth, &boxHeight, &boxX, &boxY) == 4) continue;
+        else if (strncmp(line, "BITMAP", 6) == 0) row = 0;
+    }
+    if (!font || !map)
+    {
+        free(font);
+        free(map);
+        return "ERROR: Unsupported or incomplete BDF font.";
+    }
+    _CGLsetFont(font, width, height, 256 + chars, map, mapCount);
+    return 0;
+}
+
+/**
+ * Replaces the built in font for the next call to CGLmain
+ */
+const char* CGLloadFont(const char* _path)
+{
+    if (sChars) return "ERROR: Cannot change the font while running.";
+    if (!_path)
+    {
+        _CGLsetDefaultFont();
+        return 0;
+    }
+    
+    size_t size;
+    const unsigned char* data = _CGLmapFile(_path, &size);
+    if (!data) return "ERROR: Cannot open font file.";
+    
+    const char* error;
+    if (size >= 4 && data[0] == 0x36 && data[1] == 0x04) error = _CGLloadPSF(data, size);
+    else if (size >= 4 && data[0] == 0x72 && data[1] == 0xb5 && data[2] == 0x4a && data[3] == 0x86) error = _CGLloadPSF(data, size);
+    else if (size >= 9 && memcmp(data, "STARTFONT", 9) == 0) error = _CGLloadBDF(data, size);
+    else error = "ERROR: Unknown font format.";
+    
+    _CGLunmapFile(data, size);
+    return error;
+}
+
+/**
+ * Returns the home position of a codepoint in the glyph cache table
+ */
+static uint32_t _CGLcacheHash(uint32_t _codepoint)
+{
+    return (_codepoint * 2654435761u) >> 24;
+}
+
+/**
+ * Removes a codepoint from the glyph cache table, shifting back later keys of its probe run
+ */
+static void _CGLcacheRemove(uint32_t _codepoint)
+{
+    const uint32_t mask = CGL_CACHE_TABLE - 1;
+    uint32_t hole = _CGLcacheHash(_codepoint);
+    while (sCacheKeys[hole] != _codepoint + 1) hole = (hole + 1) & mask;
+    for (uint32_t i = (hole + 1) & mask; sCacheKeys[i]; i = (i + 1) & mask)
+    {
+        // A key may fill the hole when the hole lies between its home and its position
+        const uint32_t home = _CGLcacheHash(sCacheKeys[i] - 1);
+        if (((i - home) & mask) < ((i - hole) & mask)) continue;
+        sCacheKeys[hole] = sCacheKeys[i];
+        sCacheEntries[hole] = sCacheEntries[i];
+        hole = i;
+    }
+    sCacheKeys[hole] = 0;
+}
+
+/**
+ * Marks the cache slots referenced by the cells of a console
+ */
+static void _CGLcacheScanCells(const CGLContext* _context)
+{
+    for (int i = 0; i < _context->CharsArea; i++)
+    {
+        const int glyph = _context->Chars[i] & 255;
+        if (glyph >= 128) sSlotVisible[(glyph - 128) / 32] |= 1u << (glyph % 32);
+    }
+}
+
+/**
+ * Marks the cache slots referenced by any console or layer, hidden layers included as they may be shown again
+ */
+static void _CGLcacheScanVisible()
+{
+    memset(sSlotVisible, 0, sizeof(sSlotVisible));
+    _CGLstoreContext(sContext);
+    for (CGLContext* context = sContexts; context; context = context->next)
+    {
+        _CGLcacheScanCells(context);
+        for (CGLContext* layer = context->Layers; layer; layer = layer->next) _CGLcacheScanCells(layer);
+    }
+    sSlotVisibleValid = GL_TRUE;
+}
+
+/**
+ * Copies the glyph of a codepoint into a cache slot, evicting the least recently used slot
+ * that is neither on screen nor used this tick. Returns the glyph, or '?' when nothing can be evicted.
+ */
+static int _CGLcacheMiss(uint32_t _codepoint)
+{
+    const int glyph = _CGLfontGlyph(_codepoint);
+    if (glyph < 0) return '?';
+    if (glyph < 128) return glyph;
+    
+    int slot = -1;
+    if (sCacheUsed < CGL_CACHE_SLOTS)
+    {
+        slot = sCacheUsed++;
+    }
+    else
+    {
+        if (!sSlotVisibleValid) _CGLcacheScanVisible();
+        for (int i = 0; i < CGL_CACHE_SLOTS; i++)
+        {
+            if (sSlotTicks[i] == sCacheTick || (sSlotVisible[i / 32] & (1u << (i % 32)))) continue;
+            if (slot < 0 || sSlotTicks[i] < sSlotTicks[slot]) slot = i;
+        }
+        if (slot < 0) return '?';
+        _CGLcacheRemove(sSlotCodepoints[slot]);
+    }
+    
+    uint32_t i = _CGLcacheHash(_codepoint);
+    while (sCacheKeys[i]) i = (i + 1) & (CGL_CACHE_TABLE - 1);
+    sCacheKeys[i] = _codepoint + 1;
+    sCacheEntries[i] = slot;
+    sSlotCodepoints[slot] = _codepoint;
+    sSlotTicks[slot] = sCacheTick;
+    sSlotPending[slot / 32] |= 1u << (slot % 32);
+    sGlyphsPending = GL_TRUE;
+    sGlyphBits[128 + slot] = sFontBits + (size_t)glyph * sGlyphHeight * ((sGlyphWidth + 7) / 8);
+    return 128 + slot;
+}
+
+/**
+ * Points every glyph at the current font and empties the glyph cache
+ */
+static void _CGLinitGlyphs()
+{
+    if (!sLoadedFont) _CGLsetDefaultFont();
+    const size_t glyphSize = sGlyphHeight * ((sGlyphWidth + 7) / 8);
+    for (int i = 0; i < 256; i++) sGlyphBits[i] = sFontBits + (i < sGlyphCount ? i : 0) * glyphSize;
+    memset(sCacheKeys, 0, sizeof(sCacheKeys));
+    memset(sSlotTicks, 0, sizeof(sSlotTicks));
+    memset(sSlotPending, 0, sizeof(sSlotPending));
+    sSlotVisibleValid = GL_FALSE;
+    sGlyphsPending = GL_FALSE;
+    sCacheUsed = 0;
+    sCacheTick = 1;
+}
+
+/**
+ * Starts a tick, glyphs looked up from now on are kept until the next one
+ */
+static void _CGLcacheNextTick()
+{
+    sCacheTick++;
+    sSlotVisibleValid = GL_FALSE;
+}
+
+/**
+ * Sends glyphs copied into cache slots to the font texture
+ */
+static void _CGLuploadGlyphs()
+{
+    GLubyte texels[32 * 32];
+    const int rowBytes = (sGlyphWidth + 7) / 8;
+    glBindTexture(GL_TEXTURE_2D, sFontTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (int slot = 0; slot < CGL_CACHE_SLOTS; slot++)
+    {
+        if (!(sSlotPending[slot / 32] & (1u << (slot % 32)))) continue;
+        const int glyph = 128 + slot;
+        const GLubyte* bits = sGlyphBits[glyph];
+        for (int yy = 0; yy < sGlyphHeight; yy++, bits += rowBytes)
+        {
+            for (int xx = 0; xx < sGlyphWidth; xx++)
+            {
+                texels[yy * sGlyphWidth + xx] = ((bits[xx / 8] >> (7 - xx % 8)) & 1) * 255;
+            }
+        }
+        glTexSubImage2D(GL_TEXTURE_2D, 0, (glyph % 16) * sGlyphWidth, (glyph / 16) * sGlyphHeight, sGlyphWidth, sGlyphHeight, GL_ALPHA, GL_UNSIGNED_BYTE, texels);
+        sFrame.bytesUploaded += sGlyphWidth * sGlyphHeight;
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    memset(sSlotPending, 0, sizeof(sSlotPending));
+    sGlyphsPending = GL_FALSE;
+}
+
+/**
+ * Appends an unsigned LEB128 value
+ */
+static GLubyte* _CGLputVarint(GLubyte* _p, uint32_t _value)
+{
+    while (_value >= 0x80)
+    {
+        *_p++ = (GLubyte)(_value | 0x80);
+        _value >>= 7;
+    }
+    *_p++ = (GLubyte)_value;
+    return _p;
+}
+
+/**
+ * Reads an unsigned LEB128 value, returns NULL when it runs past _end
+ */
+static const unsigned char* _CGLgetVarint(const unsigned char* _p, const unsigned char* _end, uint32_t* _value)
+{
+    uint32_t value = 0;
+    for (int shift = 0; _p < _end && shift < 35; shift += 7)
+    {
+        const unsigned char byte = *_p++;
+        value |= (uint32_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+        {
+            *_value = value;
+            return _p;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Returns the number of equal cells starting at _first
+ */
+static int _CGLrunLength(const GLushort* _cells, int _first, int _last)
+{
+    int x = _first + 1;
+    while (x < _last && _cells[x] == _cells[_first]) x++;
+    return x - _first;
+}
+
+/**
+ * Encodes the changes to columns [_first, _last) of a row against its shadow and updates the shadow.
+ * Returns _out when nothing changed.
+ */
+static GLubyte* _CGLrecordRow(GLubyte* _out, int _op, int _row, const GLushort* _cells, GLushort* _shadow, int _first, int _last)
+{
+    GLubyte* p = _CGLputVarint(_CGLputVarint(_out, _op), _row);
+    int mark = 0; // First column not yet covered by a token
+    int x = _first;
+    while (x < _last)
+    {
+        if (_cells[x] == _shadow[x])
+        {
+            x++;
+            continue;
+        }
+        if (x > mark) p = _CGLputVarint(p, (x - mark) << 2 | CGL_RECORD_SKIP);
+        const int run = _CGLrunLength(_cells, x, _last);
+        if (run >= CGL_RECORD_MIN_FILL)
+        {
+            p = _CGLputVarint(_CGLputVarint(p, run << 2 | CGL_RECORD_FILL), _cells[x]);
+            memcpy(_shadow + x, _cells + x, run * sizeof(GLushort));
+            x = mark = x + run;
+            continue;
+        }
+        int end = x + 1;
+        while (end < _last && _cells[end] != _shadow[end] && _CGLrunLength(_cells, end, _last) < CGL_RECORD_MIN_FILL) end++;
+        p = _CGLputVarint(p, (end - x) << 2 | CGL_RECORD_XOR);
+        for (; x < end; x++)
+        {
+            p = _CGLputVarint(p, _cells[x] ^ _shadow[x]);
+            _shadow[x] = _cells[x];
+        }
+        mark = x;
+    }
+    if (mark == 0) return _out;
+    return _CGLputVarint(p, CGL_RECORD_END);
+}
+
+/**
+ * Keeps the dirty spans of the main console for the next recorded frame, call before a renderer consumes them
+ */
+static void _CGLrecordSpans()
+{
+    CGLContext* current = sContext;
+    CGLmakeCurrent(NULL);
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        if (sDirtyMin[y] < sRecordMin[y]) sRecordMin[y] = sDirtyMin[y];
+        if (sDirtyMax[y] > sRecordMax[y]) sRecordMax[y] = sDirtyMax[y];
+    }
+    CGLmakeCurrent(current);
+}
+
+/**
+ * Writes the changes the main console went through since the last recorded frame
+ */
+static void _CGLrecordFrame(double _now)
+{
+    CGLContext* current = sContext;
+    CGLmakeCurrent(NULL);
+    
+    GLubyte* p = sRecordBuffer;
+    if (sRecordOrigin != sRowOrigin)
+    {
+        p = _CGLputVarint(_CGLputVarint(p, CGL_RECORD_ORIGIN), sRowOrigin);
+        sRecordOrigin = sRowOrigin;
+    }
+    // Only rows with dirty spans can have changed since the last recorded frame
+    for (int y = 0; y < sCharsHeight; y++)
+    {
+        const int first = sRecordFull ? 0 : sDirtyMin[y] < sRecordMin[y] ? sDirtyMin[y] : sRecordMin[y];
+        const int last = sRecordFull ? sCharsWidth : sDirtyMax[y] > sRecordMax[y] ? sDirtyMax[y] : sRecordMax[y];
+        sRecordMin[y] = sCharsWidth;
+        sRecordMax[y] = 0;
+        if (first >= last) continue;
+        const int offset = y * sCharsWidth;
+        p = _CGLrecordRow(p, CGL_RECORD_CELLS, y, sChars + offset, sRecordShadow + offset, first, last);
+        if (sRecordColors) p = _CGLrecordRow(p, CGL_RECORD_COLORS, y, sCellColors + offset, sRecordColors + offset, first, last);
+    }
+    sRecordFull = GL_FALSE;
+    CGLmakeCurrent(current);
+    if (p == sRecordBuffer) return;
+    
+    // Frames start with the microseconds since the previous one
+    GLubyte time[5];
+    const double elapsed = (_now - sRecordTime) * 1e6;
+    const size_t timeSize = _CGLputVarint(time, elapsed < 4e9 ? (uint32_t)elapsed : 4000000000u) - time;
+    sRecordTime = _now;
+    p = _CGLputVarint(p, CGL_RECORD_FRAME_END);
+    fwrite(time, 1, timeSize, sRecordFile);
+    fwrite(sRecordBuffer, 1, p - sRecordBuffer, sRecordFile);
+}
+
+/**
+ * Stops recording and closes the file
+ */
+static void _CGLrecordStop()
+{
+    if (sRecordFile) fclose(sRecordFile);
+    sRecordFile = NULL;
+    free(sRecordShadow);
+    free(sRecordColors);
+    free(sRecordBuffer);
+    free(sRecordMin);
+    free(sRecordMax);
+    sRecordShadow = sRecordColors = NULL;
+    sRecordBuffer = NULL;
+    sRecordMin = sRecordMax = NULL;
+}
+
+/**
+ * Starts recording the main console
+ */
+const char* CGLrecord(const char* _path)
+{
+    _CGLrecordStop();
+    if (!_path) return 0;
+    if (!sChars) return "ERROR: CGLrecord must be called while CGLmain is running.";
+    
+    CGLContext* current = sContext;
+    CGLmakeCurrent(NULL);
+    const int columns = sCharsWidth;
+    const int rows = sCharsHeight;
+    const GLboolean colors = sCellColors != NULL;
+    CGLmakeCurrent(current);
+    
+    // Worst case per row and plane: an op, alternating single cell skips and xors, and an end token
+    sRecordShadow = calloc(columns * rows, sizeof(GLushort));
+    sRecordColors = colors ? calloc(columns * rows, sizeof(GLushort)) : NULL;
+    sRecordBuffer = malloc(rows * 2 * (columns * 5 + 16) + 16);
+    sRecordMin = malloc(rows * sizeof(int));
+    sRecordMax = malloc(rows * sizeof(int));
+    if (!sRecordShadow || (colors && !sRecordColors) || !sRecordBuffer || !sRecordMin || !sRecordMax)
+    {
+        _CGLrecordStop();
+        return "ERROR: Cannot allocate recording buffers.";
+    }
+    sRecordFile = fopen(_path, "wb");
+    if (!sRecordFile)
+    {
+        _CGLrecordStop();
+        return "ERROR: Cannot open recording file.";
+    }
+    
+    GLubyte header[32] = {'C', 'G', 'L', 'R'};
+    GLubyte* p = header + 4;
+    p = _CGLputVarint(p, CGL_RECORD_VERSION);
+    p = _CGLputVarint(p, columns);
+    p = _CGLputVarint(p, rows);
+    p = _CGLputVarint(p, colors);
+    fwrite(header, 1, p - header, sRecordFile);
+    
+    // The first frame holds every cell against the zeroed shadow
+    sRecordOrigin = -1;
+    for (int y = 0; y < rows; y++)
+    {
+        sRecordMin[y] = columns;
+        sRecordMax[y] = 0;
+    }
+    sRecordFull = GL_TRUE;
+    sRecordTime = _CGLtime();
+    return 0;
+}
+
+/**
+ * Applies span tokens to a row, returns NULL on a malformed row
+ */
+static const unsigned char* _CGLplayRow(const unsigned char* _p, const unsigned char* _end, int _row, GLushort* _cells)
+{
+    int x = 0;
+    int first = sCharsWidth;
+    for (;;)
+    {
+        uint32_t token;
+        uint32_t value;
+        _p = _CGLgetVarint(_p, _end, &token);
+        if (!_p) return NULL;
+        const int kind = token & 3;
+        const uint32_t count = token >> 2;
+        if (kind == CGL_RECORD_END) break;
+        if (count > (uint32_t)(sCharsWidth - x)) return NULL;
+        if (kind != CGL_RECORD_SKIP && x < first) first = x;
+        if (kind == CGL_RECORD_FILL)
+        {
+            _p = _CGLgetVarint(_p, _end, &value);
+            if (!_p) return NULL;
+            for (uint32_t i = 0; i < count; i++) _cells[x + i] = (GLushort)value;
+        }
+        else if (kind == CGL_RECORD_XOR)
+        {
+            for (uint32_t i = 0; i < count; i++)
+            {
+                _p = _CGLgetVarint(_p, _end, &value);
+                if (!_p) return NULL;
+                _cells[x + i] ^= (GLushort)value;
+            }
+        }
+        x += count;
+    }
+    if (first < x) _CGLmarkDirty(_row, first, x);
+    return _p;
+}
+
+/**
+ * Applies one recorded frame to the main console, returns GL_FALSE on a malformed frame
+ */
+static GLboolean _CGLplayFrame(const unsigned char* _p, const unsigned char* _end)
+{
+    for (;;)
+    {
+        uint32_t op;
+        uint32_t value;
+        _p = _CGLgetVarint(_p, _end, &op);
+        if (!_p) return GL_FALSE;
+        if (op == CGL_RECORD_FRAME_END) break;
+        _p = _CGLgetVarint(_p, _end, &value);
+        if (!_p || value >= (uint32_t)sCharsHeight) return GL_FALSE;
+        if (op == CGL_RECORD_ORIGIN)
+        {
+            sRowOrigin = value;
+            sDirty = GL_TRUE;
+        }
+        else if (op == CGL_RECORD_CELLS)
+        {
+            GLushort* row = sChars + value * sCharsWidth;
+            const int blinks = _CGLcountBlinks(row, sCharsWidth);
+            _p = _CGLplayRow(_p, _end, value, row);
+            if (!_p) return GL_FALSE;
+            _CGLaddBlinks(value, _CGLcountBlinks(row, sCharsWidth) - blinks);
+        }
+        else if (op == CGL_RECORD_COLORS && sCellColors)
+        {
+            _p = _CGLplayRow(_p, _end, value, sCellColors + value * sCharsWidth);
+            if (!_p) return GL_FALSE;
+        }
+        else
+        {
+            return GL_FALSE;
+        }
+    }
+    sPlayPos = _p - sPlayData;
+    return GL_TRUE;
+}
+
+/**
+ * Stops playback and unmaps the file
+ */
+static void _CGLplayStop()
+{
+    if (sPlayData) _CGLunmapFile(sPlayData, sPlaySize);
+    sPlayData = NULL;
+}
+
+/**
+ * Applies the recorded frames that are due, or the next one when playing as fast as possible
+ */
+static void _CGLplayTick(double _now)
+{
+    CGLContext* current = sContext;
+    CGLmakeCurrent(NULL);
+    const unsigned char* end = sPlayData + sPlaySize;
+    while (sPlayData)
+    {
+        uint32_t delta;
+        const unsigned char* frame = _CGLgetVarint(sPlayData + sPlayPos, end, &delta);
+        if (!frame)
+        {
+            _CGLplayStop();
+            break;
+        }
+        sPlayNext = sPlayStart + sPlayTime + delta * 1e-6;
+        if (!sPlayFast && sPlayNext > _now) break;
+        sPlayTime += delta * 1e-6;
+        if (!_CGLplayFrame(frame, end)) _CGLplayStop();
+        if (sPlayFast)
+        {
+            sPlayNext = _now;
+            break;
+        }
+    }
+    CGLmakeCurrent(current);
+}
+
+/**
+ * Starts replaying a recording into the main console
+ */
+const char* CGLplay(const char* _path, int _mode)
+{
+    _CGLplayStop();
+    if (!_path) return 0;
+    if (!sChars) return "ERROR: CGLplay must be called while CGLmain is running.";
+    
+    size_t size;
+    const unsigned char* data = _CGLmapFile(_path, &size);
+    if (!data) return "ERROR: Cannot open recording file.";
+    
+    uint32_t version = 0, columns = 0, rows = 0, colors = 0;
+    const unsigned char* end = data + size;
+    const unsigned char* p = size >= 4 && memcmp(data, "CGLR", 4) == 0 ? data + 4 : NULL;
+    if (p) p = _CGLgetVarint(p, end, &version);
+    if (p) p = _CGLgetVarint(p, end, &columns);
+    if (p) p = _CGLgetVarint(p, end, &rows);
+    if (p) p = _CGLgetVarint(p, end, &colors);
+    if (!p || version != CGL_RECORD_VERSION)
+    {
+        _CGLunmapFile(data, size);
+        return "ERROR: Not a ConsoleGL recording.";
+    }
+    
+    CGLContext* current = sContext;
+    CGLmakeCurrent(NULL);
+    const GLboolean matches = columns == (uint32_t)sCharsWidth && rows == (uint32_t)sCharsHeight && colors == (sCellColors != NULL);
+    if (matches)
+    {
+        // Recordings start from a zeroed screen
+        sRowOrigin = 0;
+        _CGLclearRows(0, sCharsHeight, 0, 0);
+    }
+    CGLmakeCurrent(current);
+    if (!matches)
+    {
+        _CGLunmapFile(data, size);
+        return "ERROR: Recording does not match the console size or colors.";
+    }
+    
+    sPlayData = data;
+    sPlaySize = size;
+    sPlayPos = p - data;
+    sPlayFast = _mode == CGL_PLAY_FAST;
+    sPlayStart = _CGLtime();
+    sPlayTime = 0.0;
+    sPlayNext = sPlayStart;
+    return 0;
+}
+
+/**
+ * Returns non zero while a recording is being replayed
+ */
+int CGLplaying()
+{
+    return sPlayData != NULL;
+}
+
+/**
+ * Fills _stats with the statistics of the most recent frames
+ */
+void CGLgetStats(CGLstats* _stats)
+{
+    memset(_stats, 0, sizeof(*_stats));
+    const int frames = sFrameCount < CGL_STATS_FRAMES ? sFrameCount : CGL_STATS_FRAMES;
+    _stats->frames = frames;
+    if (frames == 0) return;
+    
+    double times[CGL_STATS_FRAMES];
+    int gpuFrames = 0;
+    for (int i = 0; i < frames; i++)
+    {
+        const CGLframeStats* frame = &sFrames[i];
+        times[i] = frame->time;
+        for (int p = 0; p < CGL_PHASE_COUNT; p++) _stats->phaseTime[p] += frame->phases[p];
+        if (frame->gpu >= 0.0)
+        {
+            _stats->gpuTime += frame->gpu;
+            gpuFrames++;
+        }
+        _stats->cellsChanged += frame->cellsChanged;
+        _stats->cellsRebuilt += frame->cellsRebuilt;
+        _stats->bytesUploaded += frame->bytesUploaded;
+    }
+    
+    // Nearest rank percentiles
+    qsort(times, frames, sizeof(double), _CGLcompareTimes);
+    _stats->frameTime50 = _CGLpercentile(times, frames, 50);
+    _stats->frameTime90 = _CGLpercentile(times, frames, 90);
+    _stats->frameTime99 = _CGLpercentile(times, frames, 99);
+    _stats->frameTimeMax = times[frames - 1];
+    for (int p = 0; p < CGL_PHASE_COUNT; p++) _stats->phaseTime[p] /= frames;
+    if (gpuFrames > 0) _stats->gpuTime /= gpuFrames;
+    _stats->cellsChanged /= frames;
+    _stats->cellsRebuilt /= frames;
+    _stats->bytesUploaded /= frames;
+    
+    const int events = sLatencyCount < CGL_STATS_FRAMES ? sLatencyCount : CGL_STATS_FRAMES;
+    _stats->inputEvents = events;
+    if (events == 0) return;
+    memcpy(times, sLatencies, events * sizeof(double));
+    qsort(times, events, sizeof(double), _CGLcompareTimes);
+    _stats->inputLatency50 = _CGLpercentile(times, events, 50);
+    _stats->inputLatency90 = _CGLpercentile(times, events, 90);
+    _stats->inputLatency99 = _CGLpercentile(times, events, 99);
+    _stats->inputLatencyMax = times[events - 1];
+}
+
+/**
+ * Takes the oldest queued input event
+ */
+int CGLpollEvent(CGLevent* _event)
+{
+    if (sEventCount == 0) return 0;
+    *_event = sEvents[sEventFirst];
+    sEventFirst = (sEventFirst + 1) % CGL_EVENT_QUEUE;
+    sEventCount--;
+    if (sTakenCount < CGL_EVENT_QUEUE)
+    {
+        sTakenTimes[sTakenCount] = _event->time;
+        sTakenTypes[sTakenCount++] = _event->type;
+    }
+    return 1;
+}
+
+/**
+ * Starts writing Chrome trace events
+ */
+const char* CGLtrace(const char* _path)
+{
+    _CGLtraceStop();
+    if (!_path) return 0;
+    sTraceFile = fopen(_path, "w");
+    if (!sTraceFile) return "ERROR: Cannot open trace file.";
+    sTraceStart = _CGLtime();
+    fprintf(sTraceFile, "[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"frames\"}},\n"
+                        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"phases\"}},\n"
+                        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,\"args\":{\"name\":\"gpu\"}},\n"
+                        "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":3,\"args\":{\"name\":\"input\"}}");
+    sTraceFirst = GL_FALSE;
+    return 0;
+}
+
+/**
+ * Allocates the screen buffer and its bookkeeping, showing _viewColumns x _viewRows of it
+ */
+static const char* _CGLinitGrid(int _columns, int _rows, int _viewColumns, int _viewRows)
+{
+    sCharsWidth = _columns;
+    sCharsHeight = _rows;
+    sCharsArea = _columns * _rows;
+    sCharsXPos = 0;
+    sCharsYPos = 0;
+    sRowOrigin = 0;
+    sScrollTop = 0;
+    sScrollBottom = _rows;
+    sLastAttrib = (128 + 31) << 8;
+    sLastColors = 15 | (1 << 8);
+    sCellColors = NULL;
+    sFeedState = CGL_FEED_GROUND;
+    sFeedWrapPending = GL_FALSE;
+    sFeedFg = 7;
+    sFeedBg = 0;
+    sFeedBold = sFeedBlink = sFeedReverse = GL_FALSE;
+    sFeedSavedX = sFeedSavedY = 0;
+    sPaneCol = sPaneRow = 0;
+    sVertexOrigin = -1;
+    sViewCol = sViewRow = 0;
+    sViewColumns = _viewColumns > 0 && _viewColumns < _columns ? _viewColumns : _columns;
+    sViewRows = _viewRows > 0 && _viewRows < _rows ? _viewRows : _rows;
+    sSlotTiles = sTileSlots = NULL;
+    
+    sPrintFBuffer = malloc(sizeof(char) * sCharsArea);
+    if (!sPrintFBuffer) return "ERROR: Cannot allocate printf buffer.";
+    
+    // Allocate screen buffer
+    sChars = malloc(_columns * _rows * sizeof(unsigned short));
+    if (!sChars) return "ERROR: Cannot allocate screen buffer.";
+    memset(sChars, 0, sCharsArea * sizeof(GLushort));
+    
+    // Allocate dirty spans
+    sDirtyMin = malloc(_rows * sizeof(int));
+    sDirtyMax = malloc(_rows * sizeof(int));
+    if (!sDirtyMin || !sDirtyMax) return "ERROR: Cannot allocate dirty spans.";
+    _CGLmarkAllDirty();
+    
+    // Allocate blink counts
+    sRowBlinks = calloc(_rows, sizeof(int));
+    if (!sRowBlinks) return "ERROR: Cannot allocate blink counts.";
+    sBlinkCount = 0;
+    
+    // Allocate the color plane, matching the zeroed attributes
+    if (sColorMode == CGL_COLORS_256)
+    {
+        sCellColors = calloc(sCharsArea, sizeof(GLushort));
+        if (!sCellColors) return "ERROR: Cannot allocate color plane.";
+    }
+    
+    // Allocate tile slots, enough for the tiles any view position touches: one more column
+    // for a view between tiles and two more rows for one that also wraps at the row origin
+    const int tileColumns = (_columns + CGL_TILE_COLUMNS - 1) / CGL_TILE_COLUMNS;
+    const int tileRows = (_rows + CGL_TILE_ROWS - 1) / CGL_TILE_ROWS;
+    sSlotColumns = (sViewColumns + CGL_TILE_COLUMNS - 1) / CGL_TILE_COLUMNS + 1;
+    sSlotRows = (sViewRows + CGL_TILE_ROWS - 1) / CGL_TILE_ROWS + 2;
+    if (sSlotColumns > tileColumns) sSlotColumns = tileColumns;
+    if (sSlotRows > tileRows) sSlotRows = tileRows;
+    sSlotTiles = malloc(sSlotColumns * sSlotRows * sizeof(int));
+    sTileSlots = malloc(tileColumns * tileRows * sizeof(int));
+    if (!sSlotTiles || !sTileSlots) return "ERROR: Cannot allocate tiles.";
+    
+    return 0;
+}
+
+/**
+ * Releases everything _CGLinitGrid allocated for the current console
+ */
+static void _CGLfreeContext()
+{
+    // Layers go with the console they are composited into
+    if (sLayers)
+    {
+        CGLContext owner;
+        _CGLstoreContext(&owner);
+        for (CGLContext* layer = owner.Layers; layer;)
+        {
+            CGLContext* next = layer->next;
+            _CGLloadContext(layer);
+            _CGLfreeContext();
+            free(layer);
+            layer = next;
+        }
+        _CGLloadContext(&owner);
+        sLayers = NULL;
+    }
+    free(sShown);
+    free(sShownColors);
+    sShown = sShownColors = NULL;
+    
+    free(sPrintFBuffer);
+    sPrintFBuffer = NULL;
+    
+    free(sChars);
+    sChars = NULL;
+    
+    free(sDirtyMin);
+    free(sDirtyMax);
+    sDirtyMin = sDirtyMax = NULL;
+    
+    free(sRowBlinks);
+    sRowBlinks = NULL;
+    
+    free(sCellColors);
+    sCellColors = NULL;
+    
+    free(sSlotTiles);
+    free(sTileSlots);
+    sSlotTiles = sTileSlots = NULL;
+}
+
+/**
+ * Releases every console and everything allocated by the backends
+ */
+static void _CGLfreeGrid()
+{
+    _CGLapplyBatches();
+    _CGLrecordStop();
+    _CGLplayStop();
+    _CGLtraceStop();
+    sTimerActive = GL_FALSE;
+    
+    _CGLstoreContext(sContext);
+    CGLContext* context = sContexts;
+    while (context)
+    {
+        CGLContext* next = context->next;
+        _CGLloadContext(context);
+        _CGLfreeContext();
+        if (context != &sMainContext) free(context);
+        context = next;
+    }
+    sMainContext.next = NULL;
+    sContexts = sContext = &sMainContext;
+    _CGLstoreContext(&sMainContext);
+    
+    free(sIndexBuffer);
+    free(sVertexBuffer);
+    free(sTextureCoordBuffer);
+    free(sFgColorBuffer);
+    free(sBgColorBuffer);
+    sIndexBuffer = NULL;
+    sVertexBuffer = NULL;
+    sTextureCoordBuffer = NULL;
+    sFgColorBuffer = sBgColorBuffer = NULL;
+    
+    free(sQuadBuffer);
+    sQuadBuffer = NULL;
+    
+    free(sSlotDirtyMin);
+    free(sSlotDirtyMax);
+    free(sSlotBuilt);
+    sSlotDirtyMin = sSlotDirtyMax = NULL;
+    sSlotBuilt = NULL;
+    
+    // The GL context is gone, and with it the mappings and fences
+    free(sStreamDirtyMin);
+    free(sStreamDirtyMax);
+    free(sStreamBuilt);
+    sStreamDirtyMin = sStreamDirtyMax = NULL;
+    sStreamBuilt = NULL;
+    memset(sStreamMaps, 0, sizeof(sStreamMaps));
+    memset(sStreamFences, 0, sizeof(sStreamFences));
+    sStreamMode = CGL_STREAM_SUBDATA;
+    
+    _CGLfreePool();
+    free(sRebuildJobs);
+    sRebuildJobs = NULL;
+    sRebuildJobCount = sRebuildJobCapacity = sRebuildCells = 0;
+    
+    free(sFramebuffer);
+    sFramebuffer = NULL;
+    
+    _CGLfreeTerminal();
+}
+
+/**
+ * Places every console in the renderer buffers after consoles were created or destroyed,
+ * returns an error message on failure
+ */
+static const char* _CGLlayout()
+{
+    int index = 0;
+    int cells = 0;
+    int rows = 0;
+    int width = 0;
+    _CGLstoreContext(sContext);
+    for (CGLContext* context = sContexts; context; context = context->next)
+    {
+        context->PaneIndex = index++;
+        context->CellBase = cells;
+        context->TextureRow = rows;
+        context->VertexOrigin = -1;
+        context->FramebufferOrigin = context->RowOrigin;
+        cells += context->SlotColumns * context->SlotRows * CGL_TILE_CELLS;
+        rows += context->CharsHeight;
+        if (context->CharsWidth > width) width = context->CharsWidth;
+    }
+    _CGLloadContext(sContext);
+    sPaneCount = index;
+    sCellCount = cells;
+    sMainCells = sMainContext.SlotColumns * sMainContext.SlotRows * CGL_TILE_CELLS;
+    sTextureWidth = width;
+    sTextureHeight = rows;
+    sLayoutDirty = GL_FALSE;
+    _CGLforEachContext(_CGLmarkAllDirty);
+    
+    if (sBackend != CGL_BACKEND_OPENGL) return 0;
+    if (sRenderer == CGL_RENDERER_SHADER) return _CGLlayoutShader();
+    return _CGLlayoutFixed();
+}
+
+/**
+ * Runs the main loop without a window, rendering into a CPU framebuffer or a terminal
+ */
+static const char* _CGLmainHeadless()
+{
+    if (sBackend == CGL_BACKEND_TERMINAL)
+    {
+        const char* error = _CGLinitTerminal();
+        if (error) return error;
+    }
+    else
+    {
+        sFramebufferWidth = sViewColumns * sGlyphWidth;
+        sFramebufferHeight = sViewRows * sGlyphHeight;
+        sFramebuffer = malloc(sFramebufferWidth * sFramebufferHeight * sizeof(uint32_t));
+        if (!sFramebuffer) return "ERROR: Cannot allocate framebuffer.";
+    }
+    
+    CGLprint("Hello World");
+    
+    double nextFrame = _CGLtime();
+    sNextBlink = nextFrame + BLINK_PERIOD;
+    while (!sShutdown)
+    {
+        _CGLframeBegin();
+        _CGLcacheNextTick();
+        sTickCallback();
+        _CGLapplyBatches();
+        double now = _CGLtime();
+        if (sPlayData) _CGLplayTick(now);
+        if (sRecordFile) _CGLrecordFrame(now);
+        _CGLphase(CGL_PHASE_BLINK);
+        _CGLblinkTick(now);
+        _CGLphase(CGL_PHASE_REBUILD);
+        if (sLayoutDirty) _CGLlayout();
+        if (sDirty && sBackend == CGL_BACKEND_TERMINAL) _CGLupdateTerminal();
+        else if (sDirty) _CGLupdateSoftware();
+        _CGLframeEnd();
+        
+        if (sFrameRate > 0)
+        {
+            nextFrame += 1.0 / sFrameRate;
+            if (nextFrame < now) nextFrame = now;
+        }
+        // Without window events the loop wakes for submitted batches, and still ticks now and then
+        double deadline = _CGLwaitDeadline(nextFrame);
+        if (deadline < 0.0) deadline = now + BLINK_PERIOD;
+        if (deadline > now) _CGLwaitBatches(deadline - _CGLtime());
+    }
+    
+    return 0;
+}
+
+/**
+ * Redraws after the window was uncovered or resized by the system
+ */
+static void _CGLwindowRefresh(GLFWwindow* _window)
+{
+    (void)_window;
+    sDamaged = GL_TRUE;
+}
+
+/**
+ * Fills the pointer position of an event and the cell of the window under it
+ */
+static void _CGLpointEvent(GLFWwindow* _window, CGLevent* _event, double _x, double _y)
+{
+    int width = 0;
+    int height = 0;
+    glfwGetWindowSize(_window, &width, &height);
+    const double col = width > 0 ? _x * sEventColumns / width : 0.0;
+    const double row = height > 0 ? _y * sEventRows / height : 0.0;
+    _event->col = col < 0.0 ? (int)col - 1 : (int)col;
+    _event->row = row < 0.0 ? (int)row - 1 : (int)row;
+    _event->x = _x;
+    _event->y = _y;
+}
+
+/**
+ * Queues key presses, releases and repeats
+ */
+static void _CGLkeyEvent(GLFWwindow* _window, int _key, int _scancode, int _action, int _mods)
+{
+    (void)_window;
+    CGLevent* event = _CGLqueueEvent(CGL_EVENT_KEY);
+    event->key = _key;
+    event->scancode = _scancode;
+    event->action = _action;
+    event->mods = _mods;
+}
+
+/**
+ * Queues typed codepoints
+ */
+static void _CGLcharEvent(GLFWwindow* _window, unsigned int _codepoint)
+{
+    (void)_window;
+    _CGLqueueEvent(CGL_EVENT_CHAR)->key = (int)_codepoint;
+}
+
+/**
+ * Queues pointer moves
+ */
+static void _CGLcursorEvent(GLFWwindow* _window, double _x, double _y)
+{
+    _CGLpointEvent(_window, _CGLqueueEvent(CGL_EVENT_MOUSE_MOVE), _x, _y);
+}
+
+/**
+ * Queues mouse button presses and releases at the pointer
+ */
+static void _CGLbuttonEvent(GLFWwindow* _window, int _button, int _action, int _mods)
+{
+    double x, y;
+    glfwGetCursorPos(_window, &x, &y);
+    CGLevent* event = _CGLqueueEvent(CGL_EVENT_MOUSE_BUTTON);
+    _CGLpointEvent(_window, event, x, y);
+    event->key = _button;
+    event->action = _action;
+    event->mods = _mods;
+}
+
+/**
+ * Queues scrolling at the pointer
+ */
+static void _CGLscrollEvent(GLFWwindow* _window, double _x, double _y)
+{
+    double x, y;
+    glfwGetCursorPos(_window, &x, &y);
+    CGLevent* event = _CGLqueueEvent(CGL_EVENT_SCROLL);
+    _CGLpointEvent(_window, event, x, y);
+    event->x = _x;
+    event->y = _y;
+}
+
+/**
+ * Queues framebuffer size changes and draws to the whole new framebuffer
+ */
+static void _CGLresizeEvent(GLFWwindow* _window, int _width, int _height)
+{
+    (void)_window;
+    CGLevent* event = _CGLqueueEvent(CGL_EVENT_RESIZE);
+    event->x = _width;
+    event->y = _height;
+    glViewport(0, 0, _width, _height);
+    sDamaged = GL_TRUE;
+}
+
+/**
+ * Runs the main loop in a GLFW window
+ */
+static const char* _CGLmainOpenGL(const char* _windowTitle)
+{
+    GLFWwindow* window;
+    
+    /* Initialize the library */
+    if (!glfwInit()) return _CGLerror("ERROR: glfwInit failed.");
+    
+    /* Create a windowed mode window and its OpenGL context */
+    glfwWindowHint(GLFW_RESIZABLE, GL_FALSE);
+    window = glfwCreateWindow(sViewColumns * sGlyphWidth * 2, sViewRows * sGlyphHeight * 2, _windowTitle, NULL, NULL);
+    if (!window) return _CGLerror("ERROR: glfwCreateWindow failed.");
+    glfwSetWindowRefreshCallback(window, _CGLwindowRefresh);
+    glfwSetKeyCallback(window, _CGLkeyEvent);
+    glfwSetCharCallback(window, _CGLcharEvent);
+    glfwSetCursorPosCallback(window, _CGLcursorEvent);
+    glfwSetMouseButtonCallback(window, _CGLbuttonEvent);
+    glfwSetScrollCallback(window, _CGLscrollEvent);
+    glfwSetFramebufferSizeCallback(window, _CGLresizeEvent);
+    sEventColumns = sViewColumns;
+    sEventRows = sViewRows;
+    
+    /* Make the window's context current */
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(sSwapInterval);
+    
+    // Create textures, rows of the atlas are only byte aligned for odd glyph widths
+    glGenTextures(1, &sFontTexture);
+    glBindTexture(GL_TEXTURE_2D, sFontTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_ALPHA, 16 * sGlyphWidth, 16 * sGlyphHeight, 0, GL_ALPHA, GL_UNSIGNED_BYTE, sFontAtlas);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    
+    // Fall back to the fixed function renderer when GL 3.x is not available
+    if (sRenderer == CGL_RENDERER_SHADER && !_CGLinitShader()) sRenderer = CGL_RENDERER_FIXED;
+    if (sRenderer == CGL_RENDERER_FIXED) _CGLinitFixed();
+    _CGLinitTimers();
+    
+    CGLprint("Hello World");
+    
+    double nextFrame = _CGLtime();
+    sNextBlink = nextFrame + BLINK_PERIOD;
+    sDamaged = GL_TRUE;
+    atomic_store(&sWakeable, GL_TRUE);
+    
+    /* Loop until the user closes the window */
+    while (!glfwWindowShouldClose(window) && !sShutdown)
+    {
+        /* Render here */
+        _CGLframeBegin();
+        _CGLcacheNextTick();
+        sTickCallback();
+        
+        _CGLapplyBatches();
+        double now = _CGLtime();
+        if (sPlayData) _CGLplayTick(now);
+        if (sRecordFile) _CGLrecordFrame(now);
+        _CGLphase(CGL_PHASE_BLINK);
+        GLboolean present = _CGLblinkTick(now) || sDirty || sDamaged || sPaletteDirty || !sIdle;
+        sDamaged = GL_FALSE;
+        
+        _CGLphase(CGL_PHASE_UPLOAD);
+        if (sGlyphsPending) _CGLuploadGlyphs();
+        
+        if (sPaletteDirty)
+        {
+            sPaletteDirty = GL_FALSE;
+            _CGLuploadPalette();
+        }
+        
+        if (sLayoutDirty)
+        {
+            const char* error = _CGLlayout();
+            if (error) return _CGLerror(error);
+        }
+        
+        // The shader renderer uploads the changed cells as they are, there is nothing to rebuild
+        if (sDirty)
+        {
+            sDirty = GL_FALSE;
+            if (sRenderer == CGL_RENDERER_SHADER) _CGLforEachShown(_CGLupdateShader);
+            else
+            {
+                _CGLphase(CGL_PHASE_REBUILD);
+                _CGLforEachShown(_CGLupdateFixed);
+                _CGLrunRebuild();
+                _CGLphase(CGL_PHASE_UPLOAD);
+                _CGLuploadFixed();
+            }
+        }
+
+        // Idle frames leave the last presented image on screen
+        if (present)
+        {
+            _CGLphase(CGL_PHASE_DRAW);
+            const GLboolean timed = _CGLbeginTimer();
+            glClear(GL_COLOR_BUFFER_BIT);
+            
+            if (sRenderer == CGL_RENDERER_SHADER) _CGLdrawShader();
+            else _CGLdrawFixed();
+            if (timed) _CGLendTimer();
+            
+            /* Swap front and back buffers */
+            _CGLphase(CGL_PHASE_SWAP);
+            glfwSwapBuffers(window);
+        }
+        _CGLpresentInput(present);
+        _CGLframeEnd();
+        
+        // Reading input later gives the next tick the latest input and leaves the frame the rest of the refresh
+        if (present && sInputDelay > 0) _CGLsleep(sPhaseStart + sInputDelay * 1e-3 - _CGLtime());
+        
+        if (sFrameRate > 0)
+        {
+            nextFrame += 1.0 / sFrameRate;
+            if (nextFrame < now) nextFrame = now;
+        }
+        
+        /* Poll for and process events, waiting until the next deadline when paced */
+        const double deadline = _CGLwaitDeadline(nextFrame);
+        now = _CGLtime();
+        if (deadline < 0.0) glfwWaitEvents();
+        else if (deadline > now) glfwWaitEventsTimeout(deadline - now);
+        else glfwPollEvents();
+    }
+    
+    atomic_store(&sWakeable, GL_FALSE);
+    glfwTerminate();
+    
+    return 0;
+}
+
+/**
+ *  Opens a window
+ */
+const char* CGLmain(const char* _windowTitle, int _columns, int _rows, void (*_callback)(void))
+{
+    sMainContext.next = NULL;
+    sContexts = sContext = &sMainContext;
+    sLayoutDirty = GL_TRUE;
+    _CGLinitPalette();
+    _CGLinitGlyphs();
+    const char* error = _CGLinitGrid(_columns, _rows, sViewColumnsHint, sViewRowsHint);
+    sTickCallback = _callback;
+    sShutdown = GL_FALSE;
+    sFrameCount = 0;
+    sEventBase = _CGLtime();
+    sEventFirst = sEventCount = 0;
+    sTakenCount = sLatencyCount = 0;
+    
+    if (!error)
+    {
+        if (sBackend != CGL_BACKEND_OPENGL) error = _CGLmainHeadless();
+        else error = _CGLmainOpenGL(_windowTitle);
+    }
+    
+    _CGLfreeGrid();
+    return error;
+}
+
+/**
+ * Returns the software framebuffer, RGBA with one glyph of pixels per cell
+ */
+const unsigned char* CGLgetFramebuffer(int* _width, int* _height)
+{
+    if (!sFramebuffer) return 0;
+    // The tick records its frame later, keep the dirty spans this update consumes for it
+    if (sRecordFile && sDirty) _CGLrecordSpans();
+    if (sLayoutDirty) _CGLlayout();
+    if (sDirty) _CGLupdateSoftware();
+    if (_width) *_width = sFramebufferWidth;
+    if (_height) *_height = sFramebufferHeight;
+    return (const unsigned char*)sFramebuffer;
+}
+
+/**
+ * Writes the software framebuffer to a binary PPM file
+ */
+const char* CGLsaveFrame(const char* _path)
+{
+    int width, height;
+    const unsigned char* pixels = CGLgetFramebuffer(&width, &height);
+    if (!pixels) return "ERROR: No software framebuffer.";
+    
+    FILE* file = fopen(_path, "wb");
+    if (!file) return "ERROR: Cannot open frame file.";
+    
+    unsigned char* row = malloc(width * 3);
+    if (!row)
+    {
+        fclose(file);
+        return "ERROR: Cannot allocate frame row.";
+    }
+    
+    fprintf(file, "P6\n%d %d\n255\n", width, height);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char* src = pixels + y * width * 4;
+        for (int x = 0; x < width; x++)
+        {
+            row[x * 3 + 0] = src[x * 4 + 0];
+            row[x * 3 + 1] = src[x * 4 + 1];
+            row[x * 3 + 2] = src[x * 4 + 2];
+        }
+        fwrite(row, 3, width, file);
+    }
+    
+    free(row);
+    return fclose(file) == 0 ? 0 : "ERROR: Cannot write frame file.";
+}
+
+/**
+ * Creates a console placed over the main console
+ */
+CGLContext* CGLcreateContext(int _columns, int _rows, int _col, int _row)
+{
+    if (!sChars || _columns <= 0 || _rows <= 0 || _col < 0 || _row < 0) return NULL;
+    CGLContext* current = sContext;
+    _CGLstoreContext(current);
+    if (_col + _columns > sMainContext.ViewColumns || _row + _rows > sMainContext.ViewRows) return NULL;
+    
+    CGLContext* context = calloc(1, sizeof(CGLContext));
+    if (!context) return NULL;
+    
+    // Build the new console in the statics, starting from no allocations
+    _CGLloadContext(context);
+    if (_CGLinitGrid(_columns, _rows, 0, 0))
+    {
+        _CGLfreeContext();
+        _CGLloadContext(current);
+        free(context);
+        return NULL;
+    }
+    sPaneCol = _col;
+    sPaneRow = _row;
+    _CGLstoreContext(context);
+    _CGLloadContext(current);
+    
+    CGLContext* last = sContexts;
+    while (last->next) last = last->next;
+    last->next = context;
+    sLayoutDirty = GL_TRUE;
+    return context;
+}
+
+/**
+ * Frees the composited cells of the current console, the renderers show its own cells again
+ */
+static void _CGLfreeShown()
+{
+    free(sShown);
+    free(sShownColors);
+    sShown = sShownColors = NULL;
+}
+
+/**
+ * Creates a layer composited into the current console
+ */
+CGLContext* CGLcreateLayer(int _columns, int _rows, uint16_t _transparent)
+{
+    if (!sChars || sContext->parent || _columns <= 0 || _rows <= 0) return NULL;
+    
+    // The renderers show the composited cells from the first layer on, which start as a copy
+    if (!sShown)
+    {
+        sShown = malloc(sCharsArea * sizeof(GLushort));
+        sShownColors = sCellColors ? malloc(sCharsArea * sizeof(GLushort)) : NULL;
+        if (!sShown || (sCellColors && !sShownColors))
+        {
+            _CGLfreeShown();
+            return NULL;
+        }
+        memcpy(sShown, sChars, sCharsArea * sizeof(GLushort));
+        if (sCellColors) memcpy(sShownColors, sCellColors, sCharsArea * sizeof(GLushort));
+        sComposeOrigin = sRowOrigin;
+    }
+    
+    CGLContext* parent = sContext;
+    _CGLstoreContext(parent);
+    CGLContext* layer = calloc(1, sizeof(CGLContext));
+    if (!layer)
+    {
+        if (!sLayers) _CGLfreeShown();
+        return NULL;
+    }
+    
+    // Build the layer in the statics, starting from no allocations
+    _CGLloadContext(layer);
+    if (_CGLinitGrid(_columns, _rows, 0, 0))
+    {
+        _CGLfreeContext();
+        _CGLloadContext(parent);
+        free(layer);
+        if (!sLayers) _CGLfreeShown();
+        return NULL;
+    }
+    _CGLfillRect(_transparent, _CGLattribColors(_transparent), 0, 0, _columns, _rows);
+    _CGLstoreContext(layer);
+    _CGLloadContext(parent);
+    layer->parent = parent;
+    layer->transparent = _transparent;
+    
+    CGLContext** last = &sLayers;
+    while (*last) last = &(*last)->next;
+    *last = layer;
+    return layer;
+}
+
+/**
+ * Shows a layer at _col, _row of the console it is composited into, or moves it there
+ */
+void CGLshowLayer(CGLContext* _layer, int _col, int _row)
+{
+    if (!_layer || !_layer->parent) return;
+    CGLContext* current = sContext;
+    CGLmakeCurrent(_layer->parent);
+    if (_layer->visible) _CGLmarkUnder(_layer, sComposeOrigin);
+    _layer->PaneCol = _col;
+    _layer->PaneRow = _row;
+    _layer->visible = GL_TRUE;
+    _CGLmarkUnder(_layer, sRowOrigin);
+    CGLmakeCurrent(current);
+}
+
+/**
+ * Hides a layer, showing the cells under it again
+ */
+void CGLhideLayer(CGLContext* _layer)
+{
+    if (!_layer || !_layer->parent || !_layer->visible) return;
+    CGLContext* current = sContext;
+    CGLmakeCurrent(_layer->parent);
+    _CGLmarkUnder(_layer, sComposeOrigin);
+    _layer->visible = GL_FALSE;
+    CGLmakeCurrent(current);
+}
+
+/**
+ * Destroys a layer, the console it was composited into becomes current if it was current
+ */
+static void _CGLdestroyLayer(CGLContext* _layer)
+{
+    CGLContext* current = sContext == _layer ? _layer->parent : sContext;
+    CGLhideLayer(_layer);
+    CGLmakeCurrent(_layer->parent);
+    
+    CGLContext** link = &sLayers;
+    while (*link && *link != _layer) link = &(*link)->next;
+    if (*link) *link = _layer->next;
+    
+    _CGLstoreContext(sContext);
+    _CGLloadContext(_layer);
+    _CGLfreeContext();
+    _CGLloadContext(sContext);
+    free(_layer);
+    
+    // Without layers the renderers show the console's own cells, which are current wherever nothing was marked
+    if (!sLayers) _CGLfreeShown();
+    CGLmakeCurrent(current);
+}
+
+/**
+ * Destroys a console created with CGLcreateContext
+ */
+void CGLdestroyContext(CGLContext* _context)
+{
+    if (!_context || _context == &sMainContext) return;
+    if (_context->parent)
+    {
+        _CGLdestroyLayer(_context);
+        return;
+    }
+    CGLContext* previous = sContexts;
+    while (previous->next && previous->next != _context) previous = previous->next;
+    if (!previous->next) return;
+    
+    if (_context == sContext || sContext->parent == _context) CGLmakeCurrent(NULL);
+    previous->next = _context->next;
+    _CGLstoreContext(sContext);
+    _CGLloadContext(_context);
+    _CGLfreeContext();
+    _CGLloadContext(sContext);
+    free(_context);
+    sLayoutDirty = GL_TRUE;
+}
+
+/**
+ * Makes a console current
+ */
+void CGLmakeCurrent(CGLContext* _context)
+{
+    if (!_context) _context = &sMainContext;
+    if (_context == sContext) return;
+    _CGLstoreContext(sContext);
+    _CGLloadContext(_context);
+    sContext = _context;
+}
+
+/**
+ * Returns the current console
+ */
+CGLContext* CGLgetCurrentContext()
+{
+    return sContext;
+}
+
+/**
+ * Scrolls the view of the main console to show its grid from _col, _row
+ */
+void CGLsetView(int _col, int _row)
+{
+    CGLContext* current = sContext;
+    CGLmakeCurrent(NULL);
+    if (_col > sCharsWidth - sViewColumns) _col = sCharsWidth - sViewColumns;
+    if (_row > sCharsHeight - sViewRows) _row = sCharsHeight - sViewRows;
+    if (_col < 0) _col = 0;
+    if (_row < 0) _row = 0;
+    if (_col != sViewCol || _row != sViewRow)
+    {
+        sViewCol = _col;
+        sViewRow = _row;
+        sDirty = GL_TRUE;
+        // The fixed renderer pans by translating its tiles and the shader by moving its quad,
+        // the other backends draw the view again
+        if (sBackend != CGL_BACKEND_OPENGL) _CGLmarkAllDirty();
+        else if (sRenderer == CGL_RENDERER_SHADER) sVertexOrigin = -1;
+    }
+    _CGLstoreContext(sContext);
+    CGLmakeCurrent(current);
+}
+
+/**
+ *  Sets the default color attribute used.
+ *  bits 0-3 = FG Color
+ *  bits 4-6 = BG Color
+ *  bit 7 = Blink
+ */
+void CGLsetAttrib(int _attrib)
+{
+    CGLsetAttribXY(_attrib, sCharsXPos, sCharsYPos);
+
+    sCharsXPos++;
+    if (sCharsXPos >= sCharsWidth) _CGLlineFeed();
+}
+
+/**
+ * Sets the attribute at the specified location
+ */
+void CGLsetAttribXY(int _attrib, int _col, int _row)
+{
+    if (_col < 0 || _col >= sCharsWidth || _row < 0 || _row >= sCharsHeight) return;
+    const int row = _CGLrow(_row);
+    const GLushort cell = (sChars[row * sCharsWidth + _col] & 255) | (_attrib << 8);
+    _CGLsetCell(row, _col, cell, _CGLattribColors(cell));
+}
+
+/**
+ * Sets the palette indices used by the following prints
+ */
+void CGLsetColors(int _fg, int _bg)
+{
+    sLastColors = (GLushort)((_fg & 255) | ((_bg & 255) << 8));
+    sLastAttrib = (GLushort)((sLastAttrib & 0x8000) | ((_fg & 15) << 8) | ((_bg & 7) << 12));
+}
+
+/**
+ * Sets the palette indices of the cell at the specified location
+ */
+void CGLsetColorsXY(int _fg, int _bg, int _col, int _row)
+{
+    const uint16_t colors = (uint16_t)((_fg & 255) | ((_bg & 255) << 8));
+    CGLblitColors(&colors, _col, _row, 1, 1, 1);
+}
+
+/**
+ * Copies a rectangle of fg | bg << 8 color pairs to the screen at col, row
+ */
+void CGLblitColors(const uint16_t* _colors, int _col, int _row, int _width, int _height, int _stride)
+{
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_col, _row, _width, _height, &x0, &y0, &x1, &y1)) return;
+    const uint16_t* src = _colors + (y0 - _row) * _stride + (x0 - _col);
+    for (int y = y0; y < y1; y++, src += _stride)
+    {
+        const int row = _CGLrow(y);
+        if (sCellColors)
+        {
+            memcpy(sCellColors + row * sCharsWidth + x0, src, (x1 - x0) * sizeof(GLushort));
+            continue;
+        }
+        // Without the color plane only the 16 fg and 8 bg colors of the attribute are kept
+        GLushort* dst = sChars + row * sCharsWidth + x0;
+        for (int x = 0; x < x1 - x0; x++)
+        {
+            dst[x] = (dst[x] & 0x80ff) | ((src[x] & 15) << 8) | (((src[x] >> 8) & 7) << 12);
+        }
+    }
+    _CGLmarkDirtyRect(x0, y0, x1, y1);
+}
+
+/**
+ * Replaces _count palette entries starting at _first with RGB triples
+ */
+void CGLsetPalette(int _first, int _count, const unsigned char* _rgb)
+{
+    _CGLinitPalette();
+    if (_first < 0)
+    {
+        _rgb -= _first * 3;
+        _count += _first;
+        _first = 0;
+    }
+    if (_first + _count > 256) _count = 256 - _first;
+    if (_count <= 0) return;
+    memcpy(sColors + _first * 3, _rgb, _count * 3);
+    if (!sChars) return;
+    
+    // The shader renderer looks colors up on the GPU, the others bake them into each cell
+    if (sBackend == CGL_BACKEND_OPENGL && sRenderer == CGL_RENDERER_SHADER) sPaletteDirty = GL_TRUE;
+    else _CGLforEachContext(_CGLmarkAllDirty);
+}
+
+/**
+ * Moves the cursor to the specified location
+ */
+void CGLgotoXY(int _col, int _row)
+{
+    if (_col < 0 || _col >= sCharsWidth) return;
+    if (_row < 0 || _row >= sCharsHeight) return;
+    sCharsXPos = _col;
+    sCharsYPos = _row;
+}
+
+/**
+ * Print a formatted string
+ */
+void CGLprintf(const char * _format, ...)
+{
+    va_list args;
+    va_start (args, _format);
+    int len = vsnprintf (sPrintFBuffer, sCharsArea, _format, args);
+    va_end (args);
+    if (len < 0) return;
+    if (len >= sCharsArea) len = sCharsArea - 1;
+    CGLwrite(sPrintFBuffer, len);
+}
+
+/**
+ * Print an unformatted string
+ */
+void CGLprint(const char * _string)
+{
+    CGLwrite(_string, strlen(_string));
+}
+
+/**
+ * Writes a run without line breaks at the cursor, wrapping at the right edge
+ */
+static void _CGLwriteRun(const char* _chars, size_t _length)
+{
+    while (_length > 0)
+    {
+        const int row = _CGLrow(sCharsYPos);
+        const int first = sCharsXPos;
+        const int count = _length < (size_t)(sCharsWidth - first) ? (int)_length : sCharsWidth - first;
+        _CGLputRun(row, first, _chars, count);
+        _chars += count;
+        _length -= count;
+        sCharsXPos += count;
+        if (sCharsXPos == sCharsWidth) _CGLlineFeed();
+    }
+}
+
+/**
+ * Print _length chars of a string, which need not be terminated
+ */
+void CGLwrite(const char * _chars, size_t _length)
+{
+    const char* end = _chars + _length;
+    while (_chars < end)
+    {
+        const char* newline = memchr(_chars, '\n', end - _chars);
+        const char* runEnd = newline ? newline : end;
+        _CGLwriteRun(_chars, runEnd - _chars);
+        if (!newline) break;
+        _CGLlineFeed();
+        _chars = newline + 1;
+    }
+}
+
+/**
+ * Returns the glyph that draws a codepoint, copying it into the glyph cache when enabled
+ */
+int CGLglyph(uint32_t _codepoint)
+{
+    if (_codepoint < 128) return _codepoint;
+    if (!sGlyphCache)
+    {
+        const int glyph = _CGLfontGlyph(_codepoint);
+        return glyph >= 0 && glyph < 256 ? glyph : '?';
+    }
+    for (uint32_t i = _CGLcacheHash(_codepoint); sCacheKeys[i]; i = (i + 1) & (CGL_CACHE_TABLE - 1))
+    {
+        if (sCacheKeys[i] != _codepoint + 1) continue;
+        sSlotTicks[sCacheEntries[i]] = sCacheTick;
+        return 128 + sCacheEntries[i];
+    }
+    return _CGLcacheMiss(_codepoint);
+}
+
+/**
+ * Print _length bytes of UTF-8, which need not be terminated
+ */
+void CGLwriteUTF8(const char * _chars, size_t _length)
+{
+    char glyphs[256];
+    int count = 0;
+    const unsigned char* p = (const unsigned char*)_chars;
+    const unsigned char* end = p + _length;
+    while (p < end)
+    {
+        if (*p < 0x80)
+        {
+            glyphs[count++] = *p++;
+        }
+        else
+        {
+            uint32_t codepoint;
+            const int length = _CGLdecodeUTF8(p, end, &codepoint);
+            glyphs[count++] = length ? (char)CGLglyph(codepoint) : '?';
+            p += length ? length : 1;
+        }
+        if (count == sizeof(glyphs))
+        {
+            CGLwrite(glyphs, count);
+            count = 0;
+        }
+    }
+    if (count > 0) CGLwrite(glyphs, count);
+}
+
+/**
+ * Writes a right aligned field of digits at the cursor.
+ * _digits holds the digits least significant first.
+ */
+static void _CGLwriteField(const char* _digits, int _count, GLboolean _negative, int _width, char _pad)
+{
+    const int length = _count + _negative;
+    const int padding = _width > length ? _width - length : 0;
+    const int total = padding + length;
+    
+    // Format straight into the row when the field does not wrap
+    if (sCharsXPos + total <= sCharsWidth)
+    {
+        const int row = _CGLrow(sCharsYPos);
+        const GLushort attrib = sLastAttrib;
+        GLushort* dst = sChars + row * sCharsWidth + sCharsXPos;
+        _CGLaddBlinks(row, ((attrib >> 15) & 1) * total - _CGLcountBlinks(dst, total));
+        int i = 0;
+        if (_pad == '0' && _negative) dst[i++] = '-' | attrib;
+        for (int p = 0; p < padding; p++) dst[i++] = (unsigned char)_pad | attrib;
+        if (_pad != '0' && _negative) dst[i++] = '-' | attrib;
+        for (int d = _count - 1; d >= 0; d--) dst[i++] = _digits[d] | attrib;
+        _CGLfillColors(row, sCharsXPos, sCharsXPos + total, sLastColors);
+        _CGLmarkDirty(row, sCharsXPos, sCharsXPos + total);
+        sCharsXPos += total;
+        if (sCharsXPos == sCharsWidth) _CGLlineFeed();
+        return;
+    }
+    
+    if (_pad == '0' && _negative) _CGLwriteRun("-", 1);
+    for (int p = 0; p < padding; p++) _CGLwriteRun(&_pad, 1);
+    if (_pad != '0' && _negative) _CGLwriteRun("-", 1);
+    for (int d = _count - 1; d >= 0; d--) _CGLwriteRun(_digits + d, 1);
+}
+
+/**
+ * Prints a decimal integer right aligned in a field of _width chars
+ */
+void CGLprintInt(long long _value, int _width, char _pad)
+{
+    char digits[20];
+    int count = 0;
+    const GLboolean negative = _value < 0;
+    unsigned long long value = negative ? 0ull - (unsigned long long)_value : (unsigned long long)_value;
+    do
+    {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    }
+    while (value);
+    _CGLwriteField(digits, count, negative, _width, _pad);
+}
+
+/**
+ * Prints a fixed point number, _value / 10^_decimals, right aligned in a field of _width chars
+ */
+void CGLprintFixed(long long _value, int _decimals, int _width, char _pad)
+{
+    char digits[24];
+    int count = 0;
+    const GLboolean negative = _value < 0;
+    unsigned long long value = negative ? 0ull - (unsigned long long)_value : (unsigned long long)_value;
+    if (_decimals < 0) _decimals = 0;
+    if (_decimals > 19) _decimals = 19;
+    for (int i = 0; i < _decimals; i++)
+    {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    }
+    if (_decimals > 0) digits[count++] = '.';
+    do
+    {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    }
+    while (value);
+    _CGLwriteField(digits, count, negative, _width, _pad);
+}
+
+/**
+ * Prints an unsigned hexadecimal number, zero padded to _width digits
+ */
+void CGLprintHex(unsigned long long _value, int _width)
+{
+    static const char hex[16] = "0123456789ABCDEF";
+    char digits[16];
+    int count = 0;
+    do
+    {
+        digits[count++] = hex[_value & 15];
+        _value >>= 4;
+    }
+    while (_value);
+    _CGLwriteField(digits, count, GL_FALSE, _width, '0');
+}
+
+/**
+ * Returns the first byte below 0x20 in [_chars, _end), or _end
+ */
+static const char* _CGLfindControl(const char* _chars, const char* _end)
+{
+    const unsigned char* p = (const unsigned char*)_chars;
+    const unsigned char* end = (const unsigned char*)_end;
+#if defined(CGL_SSE2)
+    const __m128i limit = _mm_set1_epi8(0x1f);
+    for (; end - p >= 16; p += 16)
+    {
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)p);
+        const int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(bytes, limit), limit));
+        if (mask)
+        {
+            while (*p >= 0x20) p++;
+            return (const char*)p;
+        }
+    }
+#elif defined(CGL_NEON)
+    const uint8x16_t limit = vdupq_n_u8(0x1f);
+    for (; end - p >= 16; p += 16)
+    {
+        const uint8x16_t controls = vcleq_u8(vld1q_u8(p), limit);
+        const uint8x8_t folded = vorr_u8(vget_low_u8(controls), vget_high_u8(controls));
+        if (vget_lane_u64(vreinterpret_u64_u8(folded), 0))
+        {
+            while (*p >= 0x20) p++;
+            return (const char*)p;
+        }
+    }
+#endif
+    while (p < end && *p >= 0x20) p++;
+    return (const char*)p;
+}
+
+/**
+ * Writes a run of printable chars for CGLfeed, deferring the wrap at the right edge like a terminal
+ */
+static void _CGLfeedText(const char* _chars, size_t _length)
+{
+    while (_length > 0)
+    {
+        if (sFeedWrapPending)
+        {
+            _CGLlineFeed();
+            sFeedWrapPending = GL_FALSE;
+        }
+        const int count = _length < (size_t)(sCharsWidth - sCharsXPos) ? (int)_length : sCharsWidth - sCharsXPos;
+        _CGLputRun(_CGLrow(sCharsYPos), sCharsXPos, _chars, count);
+        _chars += count;
+        _length -= count;
+        sCharsXPos += count;
+        if (sCharsXPos == sCharsWidth)
+        {
+            sCharsXPos = sCharsWidth - 1;
+            sFeedWrapPending = GL_TRUE;
+        }
+    }
+}
+
+/**
+ * Rebuilds sLastAttrib and sLastColors from the SGR state
+ */
+static void _CGLfeedAttrib()
+{
+    int fg = sFeedFg < 8 && sFeedBold ? sFeedFg + 8 : sFeedFg;
+    int bg = sFeedBg;
+    if (sFeedReverse)
+    {
+        const int swap = fg;
+        fg = bg;
+        bg = swap;
+    }
+    sLastColors = (GLushort)(fg | (bg << 8));
+    sLastAttrib = (GLushort)(((fg & 15) | ((bg & 7) << 4) | (sFeedBlink ? 128 : 0)) << 8);
+}
+
+/**
+ * Returns the entry of the default 256 color palette closest to an RGB color
+ */
+static int _CGLnearestColor(int _r, int _g, int _b)
+{
+    const int rgb[3] = {_r, _g, _b};
+    int cube = 16;
+    int cubeError = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        const int level = rgb[i] < 48 ? 0 : (rgb[i] < 115 ? 1 : (rgb[i] - 35) / 40);
+        const int value = level ? 55 + level * 40 : 0;
+        cube = cube * 6 + level;
+        cubeError += (rgb[i] - value) * (rgb[i] - value);
+    }
+    cube -= 16 * 6 * 6 * 6 - 16;
+    
+    const int average = (_r + _g + _b) / 3;
+    const int step = average < 8 ? 0 : (average > 238 ? 23 : (average - 3) / 10);
+    const int value = 8 + step * 10;
+    int grayError = 0;
+    for (int i = 0; i < 3; i++) grayError += (rgb[i] - value) * (rgb[i] - value);
+    return grayError < cubeError ? 232 + step : cube;
+}
+
+/**
+ * Returns CSI parameter _index, or _default when it is missing or zero
+ */
+static int _CGLfeedParam(int _index, int _default)
+{
+    if (_index >= sFeedParamCount || sFeedParams[_index] == 0) return _default;
+    return sFeedParams[_index];
+}
+
+/**
+ * Moves the cursor, clamping it to the screen
+ */
+static void _CGLfeedGoto(int _col, int _row)
+{
+    sCharsXPos = _col < 0 ? 0 : (_col >= sCharsWidth ? sCharsWidth - 1 : _col);
+    sCharsYPos = _row < 0 ? 0 : (_row >= sCharsHeight ? sCharsHeight - 1 : _row);
+    sFeedWrapPending = GL_FALSE;
+}
+
+/**
+ * Moves the cursor down a line without changing the column, scrolling at the bottom of the scroll region
+ */
+static void _CGLfeedIndex()
+{
+    const int col = sCharsXPos;
+    _CGLlineFeed();
+    sCharsXPos = col;
+}
+
+/**
+ * Moves the cursor up a line, scrolling down at the top of the scroll region
+ */
+static void _CGLfeedReverseIndex()
+{
+    if (sCharsYPos == sScrollTop) CGLscroll(-1);
+    else if (sCharsYPos > 0) sCharsYPos--;
+}
+
+/**
+ * Applies an SGR sequence
+ */
+static void _CGLfeedSGR()
+{
+    // ANSI color order matches sPalette, colors past 15 need CGL_COLORS_256
+    const int colors = sCellColors ? 256 : 16;
+    if (sFeedParamCount == 0)
+    {
+        sFeedParams[0] = 0;
+        sFeedParamCount = 1;
+    }
+    for (int i = 0; i < sFeedParamCount; i++)
+    {
+        const int p = sFeedParams[i];
+        if (p == 0)
+        {
+            sFeedFg = 7;
+            sFeedBg = 0;
+            sFeedBold = sFeedBlink = sFeedReverse = GL_FALSE;
+        }
+        else if (p == 1) sFeedBold = GL_TRUE;
+        else if (p == 22) sFeedBold = GL_FALSE;
+        else if (p == 5 || p == 6) sFeedBlink = GL_TRUE;
+        else if (p == 25) sFeedBlink = GL_FALSE;
+        else if (p == 7) sFeedReverse = GL_TRUE;
+        else if (p == 27) sFeedReverse = GL_FALSE;
+        else if (p >= 30 && p <= 37) sFeedFg = p - 30;
+        else if (p == 39) sFeedFg = 7;
+        else if (p >= 40 && p <= 47) sFeedBg = p - 40;
+        else if (p == 49) sFeedBg = 0;
+        else if (p >= 90 && p <= 97) sFeedFg = p - 90 + 8;
+        else if (p >= 100 && p <= 107) sFeedBg = p - 100 + 8;
+        else if (p == 38 || p == 48)
+        {
+            // 256 color and RGB forms, RGB is matched against the default palette
+            int color = -1;
+            if (i + 2 < sFeedParamCount && sFeedParams[i + 1] == 5)
+            {
+                if (sFeedParams[i + 2] < colors) color = sFeedParams[i + 2];
+                i += 2;
+            }
+            else if (i + 4 < sFeedParamCount && sFeedParams[i + 1] == 2)
+            {
+                const int r = sFeedParams[i + 2];
+                const int g = sFeedParams[i + 3];
+                const int b = sFeedParams[i + 4];
+                if (colors == 256) color = _CGLnearestColor(r > 255 ? 255 : r, g > 255 ? 255 : g, b > 255 ? 255 : b);
+                i += 4;
+            }
+            if (color >= 0)
+            {
+                if (p == 38) sFeedFg = color;
+                else sFeedBg = color;
+            }
+        }
+    }
+    _CGLfeedAttrib();
+}
+
+/**
+ * Dispatches a complete CSI sequence
+ */
+static void _CGLfeedCSI(char _final)
+{
+    const GLushort blank = ' ' | (sLastAttrib & 0x7f00);
+    if (sFeedPrivate && _final != 'm') return; // DEC private modes are not supported
+    switch (_final)
+    {
+        case 'A': _CGLfeedGoto(sCharsXPos, sCharsYPos - _CGLfeedParam(0, 1)); break;
+        case 'B': _CGLfeedGoto(sCharsXPos, sCharsYPos + _CGLfeedParam(0, 1)); break;
+        case 'C': _CGLfeedGoto(sCharsXPos + _CGLfeedParam(0, 1), sCharsYPos); break;
+        case 'D': _CGLfeedGoto(sCharsXPos - _CGLfeedParam(0, 1), sCharsYPos); break;
+        case 'E': _CGLfeedGoto(0, sCharsYPos + _CGLfeedParam(0, 1)); break;
+        case 'F': _CGLfeedGoto(0, sCharsYPos - _CGLfeedParam(0, 1)); break;
+        case 'G': _CGLfeedGoto(_CGLfeedParam(0, 1) - 1, sCharsYPos); break;
+        case 'd': _CGLfeedGoto(sCharsXPos, _CGLfeedParam(0, 1) - 1); break;
+        case 'H':
+        case 'f': _CGLfeedGoto(_CGLfeedParam(1, 1) - 1, _CGLfeedParam(0, 1) - 1); break;
+        case 'J':
+        {
+            const int mode = _CGLfeedParam(0, 0);
+            if (mode == 0)
+            {
+                _CGLfillSpan(sCharsYPos, sCharsXPos, sCharsWidth, blank, sLastColors);
+                _CGLclearRows(sCharsYPos + 1, sCharsHeight, blank, sLastColors);
+            }
+            else if (mode == 1)
+            {
+                _CGLclearRows(0, sCharsYPos, blank, sLastColors);
+                _CGLfillSpan(sCharsYPos, 0, sCharsXPos + 1, blank, sLastColors);
+            }
+            else
+            {
+                _CGLclearRows(0, sCharsHeight, blank, sLastColors);
+            }
+            break;
+        }
+        case 'K':
+        {
+            const int mode = _CGLfeedParam(0, 0);
+            if (mode == 0) _CGLfillSpan(sCharsYPos, sCharsXPos, sCharsWidth, blank, sLastColors);
+            else if (mode == 1) _CGLfillSpan(sCharsYPos, 0, sCharsXPos + 1, blank, sLastColors);
+            else _CGLfillSpan(sCharsYPos, 0, sCharsWidth, blank, sLastColors);
+            break;
+        }
+        case 'X':
+        {
+            const int last = sCharsXPos + _CGLfeedParam(0, 1);
+            _CGLfillSpan(sCharsYPos, sCharsXPos, last > sCharsWidth ? sCharsWidth : last, blank, sLastColors);
+            break;
+        }
+        case '@':
+        case 'P':
+        {
+            // Insert or delete chars by shifting the rest of the line
+            const int row = _CGLrow(sCharsYPos);
+            GLushort* line = sChars + row * sCharsWidth;
+            int count = _CGLfeedParam(0, 1);
+            if (count > sCharsWidth - sCharsXPos) count = sCharsWidth - sCharsXPos;
+            const int moved = sCharsWidth - sCharsXPos - count;
+            _CGLaddBlinks(row, -_CGLcountBlinks(line + sCharsXPos, sCharsWidth - sCharsXPos));
+            if (_final == '@') memmove(line + sCharsXPos + count, line + sCharsXPos, moved * sizeof(GLushort));
+            else memmove(line + sCharsXPos, line + sCharsXPos + count, moved * sizeof(GLushort));
+            if (sCellColors)
+            {
+                GLushort* colors = sCellColors + row * sCharsWidth;
+                if (_final == '@') memmove(colors + sCharsXPos + count, colors + sCharsXPos, moved * sizeof(GLushort));
+                else memmove(colors + sCharsXPos, colors + sCharsXPos + count, moved * sizeof(GLushort));
+            }
+            _CGLaddBlinks(row, _CGLcountBlinks(line + sCharsXPos, sCharsWidth - sCharsXPos));
+            _CGLmarkDirty(row, sCharsXPos, sCharsWidth);
+            if (_final == '@') _CGLfillSpan(sCharsYPos, sCharsXPos, sCharsXPos + count, blank, sLastColors);
+            else _CGLfillSpan(sCharsYPos, sCharsWidth - count, sCharsWidth, blank, sLastColors);
+            break;
+        }
+        case 'L':
+        case 'M':
+        {
+            // Insert or delete lines by scrolling the region below the cursor
+            if (sCharsYPos < sScrollTop || sCharsYPos >= sScrollBottom) break;
+            const int top = sScrollTop;
+            sScrollTop = sCharsYPos;
+            CGLscroll(_final == 'L' ? -_CGLfeedParam(0, 1) : _CGLfeedParam(0, 1));
+            sScrollTop = top;
+            sCharsXPos = 0;
+            break;
+        }
+        case 'S': CGLscroll(_CGLfeedParam(0, 1)); break;
+        case 'T': CGLscroll(-_CGLfeedParam(0, 1)); break;
+        case 'r':
+        {
+            CGLsetScrollRegion(_CGLfeedParam(0, 1) - 1, _CGLfeedParam(1, sCharsHeight) - 1);
+            _CGLfeedGoto(0, 0);
+            break;
+        }
+        case 's':
+        {
+            sFeedSavedX = sCharsXPos;
+            sFeedSavedY = sCharsYPos;
+            break;
+        }
+        case 'u': _CGLfeedGoto(sFeedSavedX, sFeedSavedY); break;
+        case 'm': if (!sFeedPrivate) _CGLfeedSGR(); break;
+    }
+}
+
+/**
+ * Handles a C0 control char
+ */
+static void _CGLfeedControl(char _char)
+{
+    switch (_char)
+    {
+        case '\n':
+        case '\v':
+        case '\f':
+        {
+            _CGLfeedIndex();
+            sFeedWrapPending = GL_FALSE;
+            break;
+        }
+        case '\r': _CGLfeedGoto(0, sCharsYPos); break;
+        case '\b': _CGLfeedGoto(sCharsXPos - 1, sCharsYPos); break;
+        case '\t': _CGLfeedGoto((sCharsXPos + 8) & ~7, sCharsYPos); break;
+        case 0x1b: sFeedState = CGL_FEED_ESCAPE; break;
+        default: break; // BEL and the rest are ignored
+    }
+}
+
+/**
+ * Advances the escape sequence state machine by one byte
+ */
+static void _CGLfeedByte(char _char)
+{
+    switch (sFeedState)
+    {
+        case CGL_FEED_ESCAPE:
+        {
+            sFeedState = CGL_FEED_GROUND;
+            switch (_char)
+            {
+                case '[':
+                {
+                    sFeedState = CGL_FEED_CSI;
+                    sFeedParamCount = 0;
+                    sFeedPrivate = GL_FALSE;
+                    memset(sFeedParams, 0, sizeof(sFeedParams));
+                    break;
+                }
+                case ']': sFeedState = CGL_FEED_OSC; break;
+                case '(':
+                case ')':
+                case '*':
+                case '+': sFeedState = CGL_FEED_CHARSET; break;
+                case 'D': _CGLfeedIndex(); break;
+                case 'E': _CGLfeedIndex(); _CGLfeedGoto(0, sCharsYPos); break;
+                case 'M': _CGLfeedReverseIndex(); break;
+                case '7':
+                {
+                    sFeedSavedX = sCharsXPos;
+                    sFeedSavedY = sCharsYPos;
+                    break;
+                }
+                case '8': _CGLfeedGoto(sFeedSavedX, sFeedSavedY); break;
+                case 'c':
+                {
+                    sFeedParamCount = 0;
+                    _CGLfeedSGR();
+                    CGLsetScrollRegion(0, sCharsHeight - 1);
+                    _CGLclearRows(0, sCharsHeight, 0, 0);
+                    _CGLfeedGoto(0, 0);
+                    break;
+                }
+                default: break;
+            }
+            break;
+        }
+        case CGL_FEED_CSI:
+        {
+            if (_char >= '0' && _char <= '9')
+            {
+                if (sFeedParamCount == 0) sFeedParamCount = 1;
+                int* param = sFeedParams + sFeedParamCount - 1;
+                if (*param < 10000) *param = *param * 10 + (_char - '0');
+            }
+            else if (_char == ';' || _char == ':')
+            {
+                if (sFeedParamCount == 0) sFeedParamCount = 1;
+                if (sFeedParamCount < CGL_FEED_MAX_PARAMS) sFeedParamCount++;
+            }
+            else if (_char == '?' || _char == '>' || _char == '=' || _char == '<')
+            {
+                sFeedPrivate = GL_TRUE;
+            }
+            else if (_char >= 0x40 && _char <= 0x7e)
+            {
+                sFeedState = CGL_FEED_GROUND;
+                _CGLfeedCSI(_char);
+            }
+            else if ((unsigned char)_char < 0x20)
+            {
+                _CGLfeedControl(_char);
+            }
+            break;
+        }
+        case CGL_FEED_OSC:
+        {
+            // Titles and other OSC strings are skipped up to BEL or ST
+            if (_char == 0x07) sFeedState = CGL_FEED_GROUND;
+            else if (_char == 0x1b) sFeedState = CGL_FEED_OSC_ESCAPE;
+            break;
+        }
+        case CGL_FEED_OSC_ESCAPE:
+        {
+            sFeedState = _char == '\\' ? CGL_FEED_GROUND : CGL_FEED_OSC;
+            break;
+        }
+        case CGL_FEED_CHARSET:
+        {
+            sFeedState = CGL_FEED_GROUND;
+            break;
+        }
+        default:
+        {
+            if ((unsigned char)_char < 0x20) _CGLfeedControl(_char);
+            else _CGLfeedText(&_char, 1);
+            break;
+        }
+    }
+}
+
+/**
+ * Feeds terminal output to the screen, see ConsoleGL.h for the supported sequences
+ */
+void CGLfeed(const char * _bytes, size_t _length)
+{
+    const char* end = _bytes + _length;
+    while (_bytes < end)
+    {
+        if (sFeedState == CGL_FEED_GROUND)
+        {
+            // Plain text is found in bulk and copied a row at a time
+            const char* control = _CGLfindControl(_bytes, end);
+            if (control > _bytes) _CGLfeedText(_bytes, control - _bytes);
+            if (control == end) break;
+            _CGLfeedControl(*control);
+            _bytes = control + 1;
+        }
+        else
+        {
+            _CGLfeedByte(*_bytes++);
+        }
+    }
+}
+
+/**
+ * Prints a single char to the screen
+ */
+void CGLputc(char _char)
+{
+    _CGLsetCell(_CGLrow(sCharsYPos), sCharsXPos, (unsigned char)_char | sLastAttrib, sLastColors);
+    if (++sCharsXPos == sCharsWidth) _CGLlineFeed();
+}
+
+/**
+ * Prints a single char to the screen
+ */
+void CGLputcXY(char _char, int _col, int _row)
+{
+    if (_col < 0 || _col >= sCharsWidth || _row < 0 || _row >= sCharsHeight) return;
+    const int row = _CGLrow(_row);
+    const int pos = row * sCharsWidth + _col;
+    const GLushort cell = (sChars[pos] & 0xFF00) | (unsigned char)_char;
+    _CGLsetCell(row, _col, cell, sCellColors ? sCellColors[pos] : 0);
+}
+
+/**
+ * Copies a rectangle of cells to the screen at col, row
+ */
+void CGLblit(const uint16_t* _cells, int _col, int _row, int _width, int _height, int _stride)
+{
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_col, _row, _width, _height, &x0, &y0, &x1, &y1)) return;
+    const uint16_t* src = _cells + (y0 - _row) * _stride + (x0 - _col);
+    for (int y = y0; y < y1; y++, src += _stride)
+    {
+        const int row = _CGLrow(y);
+        GLushort* dst = sChars + row * sCharsWidth + x0;
+        _CGLaddBlinks(row, _CGLcountBlinks(src, x1 - x0) - _CGLcountBlinks(dst, x1 - x0));
+        memcpy(dst, src, (x1 - x0) * sizeof(GLushort));
+        if (!sCellColors) continue;
+        GLushort* colors = sCellColors + row * sCharsWidth + x0;
+        for (int x = 0; x < x1 - x0; x++) colors[x] = _CGLattribColors(src[x]);
+    }
+    _CGLmarkDirtyRect(x0, y0, x1, y1);
+}
+
+/**
+ * Copies a rectangle of cells from the screen at col, row
+ */
+void CGLread(uint16_t* _cells, int _col, int _row, int _width, int _height, int _stride)
+{
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_col, _row, _width, _height, &x0, &y0, &x1, &y1)) return;
+    uint16_t* dst = _cells + (y0 - _row) * _stride + (x0 - _col);
+    for (int y = y0; y < y1; y++, dst += _stride)
+    {
+        memcpy(dst, sChars + _CGLrow(y) * sCharsWidth + x0, (x1 - x0) * sizeof(GLushort));
+    }
+}
+
+/**
+ * Fills a rectangle of the screen with one cell
+ */
+void CGLfillRect(uint16_t _cell, int _col, int _row, int _width, int _height)
+{
+    _CGLfillRect(_cell, _CGLattribColors(_cell), _col, _row, _width, _height);
+}
+
+/**
+ * Sets the attribute of a rectangle of the screen, keeping its chars
+ */
+void CGLsetAttribRect(int _attrib, int _col, int _row, int _width, int _height)
+{
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_col, _row, _width, _height, &x0, &y0, &x1, &y1)) return;
+    const GLushort attrib = (GLushort)((_attrib & 255) << 8);
+    for (int y = y0; y < y1; y++)
+    {
+        const int row = _CGLrow(y);
+        GLushort* dst = sChars + row * sCharsWidth + x0;
+        _CGLaddBlinks(row, (attrib >> 15) * (x1 - x0) - _CGLcountBlinks(dst, x1 - x0));
+        _CGLblendCells(dst, attrib, 0xff00, x1 - x0);
+        _CGLfillColors(row, x0, x1, _CGLattribColors(attrib));
+    }
+    _CGLmarkDirtyRect(x0, y0, x1, y1);
+}
+
+/**
+ * Draws the outline of a rectangle with line glyphs in the current attribute and colors
+ */
+void CGLdrawBox(int _style, int _col, int _row, int _width, int _height)
+{
+    // Corners top left, top right, bottom left, bottom right, then horizontal and vertical lines
+    static const GLubyte cp437[2][6] = {{0xda, 0xbf, 0xc0, 0xd9, 0xc4, 0xb3}, {0xc9, 0xbb, 0xc8, 0xbc, 0xcd, 0xba}};
+    static const uint32_t unicode[2][6] = {{0x250c, 0x2510, 0x2514, 0x2518, 0x2500, 0x2502}, {0x2554, 0x2557, 0x255a, 0x255d, 0x2550, 0x2551}};
+    if (_width < 2 || _height < 2) return;
+    const int style = _style == CGL_BOX_DOUBLE;
+    
+    // The built in font is CP437, loaded fonts are looked up by codepoint
+    GLushort cells[6];
+    for (int i = 0; i < 6; i++) cells[i] = (GLushort)((sFontMap ? CGLglyph(unicode[style][i]) : cp437[style][i]) | sLastAttrib);
+    
+    const int right = _col + _width - 1;
+    const int bottom = _row + _height - 1;
+    _CGLfillRect(cells[0], sLastColors, _col, _row, 1, 1);
+    _CGLfillRect(cells[1], sLastColors, right, _row, 1, 1);
+    _CGLfillRect(cells[2], sLastColors, _col, bottom, 1, 1);
+    _CGLfillRect(cells[3], sLastColors, right, bottom, 1, 1);
+    _CGLfillRect(cells[4], sLastColors, _col + 1, _row, _width - 2, 1);
+    _CGLfillRect(cells[4], sLastColors, _col + 1, bottom, _width - 2, 1);
+    _CGLfillRect(cells[5], sLastColors, _col, _row + 1, 1, _height - 2);
+    _CGLfillRect(cells[5], sLastColors, right, _row + 1, 1, _height - 2);
+}
+
+/**
+ * Moves a rectangle of the screen by _dx columns and _dy rows
+ */
+void CGLmoveRect(int _col, int _row, int _width, int _height, int _dx, int _dy)
+{
+    // Clip the source, then its destination, and take the source of what is left
+    int x0, y0, x1, y1;
+    if (!_CGLclipRect(_col, _row, _width, _height, &x0, &y0, &x1, &y1)) return;
+    if (!_CGLclipRect(x0 + _dx, y0 + _dy, x1 - x0, y1 - y0, &x0, &y0, &x1, &y1)) return;
+    const int width = x1 - x0;
+    
+    // Rows are copied away from the direction of the move so overlapping rows are read before they are written
+    const int step = _dy > 0 ? -1 : 1;
+    for (int y = _dy > 0 ? y1 - 1 : y0; y >= y0 && y < y1; y += step)
+    {
+        const int dst = _CGLrow(y);
+        const int src = _CGLrow(y - _dy);
+        GLushort* cells = sChars + dst * sCharsWidth + x0;
+        const GLushort* source = sChars + src * sCharsWidth + x0 - _dx;
+        _CGLaddBlinks(dst, _CGLcountBlinks(source, width) - _CGLcountBlinks(cells, width));
+        memmove(cells, source, width * sizeof(GLushort));
+        if (sCellColors) memmove(sCellColors + dst * sCharsWidth + x0, sCellColors + src * sCharsWidth + x0 - _dx, width * sizeof(GLushort));
+    }
+    _CGLmarkDirtyRect(x0, y0, x1, y1);
+}
+
+/**
+ * Creates an empty batch of cell writes
+ */
+CGLbatch* CGLbatchCreate()
+{
+    return calloc(1, sizeof(CGLbatch));
+}
+
+/**
+ * Reserves space for a _width x _height record, returns NULL when out of memory
+ */
+static uint16_t* _CGLbatchRecord(CGLbatch* _batch, int _col, int _row, int _width, int _height)
+{
+    // Keep records 4 byte aligned by padding odd cell counts
+    const size_t cellsSize = ((_width * _height + 1) & ~1) * sizeof(uint16_t);
+    const size_t needed = _batch->size + sizeof(CGLbatchRecord) + cellsSize;
+    if (needed > _batch->capacity)
+    {
+        size_t capacity = _batch->capacity ? _batch->capacity * 2 : 256;
+        while (capacity < needed) capacity *= 2;
+        unsigned char* data = realloc(_batch->data, capacity);
+        if (!data) return NULL;
+        _batch->data = data;
+        _batch->capacity = capacity;
+    }
+    
+    const CGLbatchRecord record = {_col, _row, _width, _height};
+    memcpy(_batch->data + _batch->size, &record, sizeof(record));
+    uint16_t* cells = (uint16_t*)(_batch->data + _batch->size + sizeof(record));
+    _batch->size = needed;
+    return cells;
+}
+
+/**
+ * Adds a rectangle of cells to a batch, see CGLblit
+ */
+void CGLbatchBlit(CGLbatch* _batch, const uint16_t* _cells, int _col, int _row, int _width, int _height, int _stride)
+{
+    if (_width <= 0 || _height <= 0) return;
+    uint16_t* dst = _CGLbatchRecord(_batch, _col, _row, _width, _height);
+    if (!dst) return;
+    for (int y = 0; y < _height; y++)
+    {
+        memcpy(dst + y * _width, _cells + y * _stride, _width * sizeof(uint16_t));
+    }
+}
+
+/**
+ * Adds a string drawn with an attribute at col, row to a batch
+ */
+void CGLbatchPrintXY(CGLbatch* _batch, const char* _string, int _attrib, int _col, int _row)
+{
+    const int len = strlen(_string);
+    if (len == 0) return;
+    uint16_t* dst = _CGLbatchRecord(_batch, _col, _row, len, 1);
+    if (!dst) return;
+    for (int i = 0; i < len; i++)
+    {
+        dst[i] = (unsigned char)_string[i] | (_attrib << 8);
+    }
+}
+
+/**
+ * Hands a batch to the render thread, which applies it whole before the next frame
+ */
+void CGLbatchSubmit(CGLbatch* _batch)
+{
+    CGLbatch* head = atomic_load_explicit(&sPendingBatches, memory_order_relaxed);
+    do
+    {
+        _batch->next = head;
+    }
+    while (!atomic_compare_exchange_weak_explicit(&sPendingBatches, &head, _batch, memory_order_release, memory_order_relaxed));
+    
+    // Wake a main loop that is waiting for events, or a headless one waiting for batches
+    if (atomic_load(&sWakeable))
+    {
+        glfwPostEmptyEvent();
+        return;
+    }
+#if defined(_WIN32)
+    AcquireSRWLockExclusive(&sWakeLock);
+    WakeConditionVariable(&sWake);
+    ReleaseSRWLockExclusive(&sWakeLock);
+#else
+    pthread_once(&sWakeOnce, _CGLinitWake);
+    pthread_mutex_lock(&sWakeLock);
+    pthread_cond_signal(&sWake);
+    pthread_mutex_unlock(&sWakeLock);
+#endif
+}
+
+/**
+ * Frees a batch that was not submitted
+ */
+void CGLbatchDestroy(CGLbatch* _batch)
+{
+    if (!_batch) return;
+    free(_batch->data);
+    free(_batch);
+}
+
+/**
+ * Scrolls the scroll region up by a number of lines, or down when negative
+ */
+void CGLscroll(int _lines)
 {
+    const int height = sScrollBottom - sScrollTop;
+    if (_lines == 0 || height <= 0) return;
+    if (_lines >= height || _lines <= -height)
+    {
+        _CGLclearRows(sScrollTop, sScrollBottom, 0, 0);
+        return;
+    }
+    
+    // Scrolling the whole screen only rotates the row origin
+    if (height == sCharsHeight)
+    {
+        sRowOrigin = (sRowOrigin + _lines + sCharsHeight) % sCharsHeight;
+        if (_lines > 0) _CGLclearRows(sCharsHeight - _lines, sCharsHeight, 0, 0);
+        else _CGLclearRows(0, -_lines, 0, 0);
+        return;
+    }
     
+    if (_lines > 0)
+    {
+        for (int y = sScrollTop; y < sScrollBottom - _lines; y++)
+        {
+            _CGLcopyRow(y, y + _lines);
+        }
+        _CGLclearRows(sScrollBottom - _lines, sScrollBottom, 0, 0);
+    }
+    else
+    {
+        for (int y = sScrollBottom - 1; y >= sScrollTop - _lines; y--)
+        {
+            _CGLcopyRow(y, y + _lines);
+        }
+        _CGLclearRows(sScrollTop, sScrollTop - _lines, 0, 0);
+    }
+    _CGLmarkDirtyRect(0, sScrollTop, sCharsWidth, sScrollBottom);
+}
+
+/**
+ * Limits scrolling to rows _top to _bottom inclusive
+ */
+void CGLsetScrollRegion(int _top, int _bottom)
+{
+    if (_top < 0) _top = 0;
+    if (_bottom >= sCharsHeight) _bottom = sCharsHeight - 1;
+    if (_top > _bottom) return;
+    sScrollTop = _top;
+    sScrollBottom = _bottom + 1;
+}
+
+/**
+ * Closes the window and cleans up once the current tick returns
+ */
+void CGLshutdown()
+{
+    sShutdown = GL_TRUE;
 }
@@ -5,11 +5,276 @@
 #ifndef CONSOLE_GL_H
 #define CONSOLE_GL_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+#define CGL_HINT_RENDERER       1
+#define CGL_HINT_BACKEND        2
+#define CGL_HINT_SWAP_INTERVAL  3
+#define CGL_HINT_FRAME_RATE     4
+#define CGL_HINT_IDLE           5
+#define CGL_HINT_COLORS         6
+#define CGL_HINT_GLYPH_CACHE    7
+#define CGL_HINT_VIEW_COLUMNS   8
+#define CGL_HINT_VIEW_ROWS      9
+#define CGL_HINT_THREADS        10
+#define CGL_HINT_INPUT_DELAY    11
+
+#define CGL_RENDERER_FIXED      0
+#define CGL_RENDERER_SHADER     1
+
+#define CGL_BACKEND_OPENGL      0
+#define CGL_BACKEND_SOFTWARE    1
+#define CGL_BACKEND_TERMINAL    2
+
+#define CGL_COLORS_16           0
+#define CGL_COLORS_256          1
+
+#define CGL_PLAY_REALTIME       0
+#define CGL_PLAY_FAST           1
+
+#define CGL_PHASE_TICK          0
+#define CGL_PHASE_BLINK         1
+#define CGL_PHASE_REBUILD       2
+#define CGL_PHASE_UPLOAD        3
+#define CGL_PHASE_DRAW          4
+#define CGL_PHASE_SWAP          5
+#define CGL_PHASE_COUNT         6
+
+#define CGL_BOX_SINGLE          0
+#define CGL_BOX_DOUBLE          1
+
+#define CGL_EVENT_KEY           1
+#define CGL_EVENT_CHAR          2
+#define CGL_EVENT_MOUSE_MOVE    3
+#define CGL_EVENT_MOUSE_BUTTON  4
+#define CGL_EVENT_SCROLL        5
+#define CGL_EVENT_RESIZE        6
+
+/**
+ * Sets a hint for the next call to CGLmain.
+ * CGL_HINT_RENDERER selects CGL_RENDERER_FIXED (default) or
+ * CGL_RENDERER_SHADER, which needs GL 3.0 and falls back to
+ * CGL_RENDERER_FIXED when unavailable.
+ * CGL_HINT_BACKEND selects CGL_BACKEND_OPENGL (default),
+ * CGL_BACKEND_SOFTWARE, which runs without a window or GL context and
+ * renders into a CPU framebuffer, or CGL_BACKEND_TERMINAL, which draws
+ * to the terminal on standard output with ANSI sequences. It only sends
+ * the cells that changed each frame, in a single write, using the
+ * terminal's own palette and scrolling.
+ * CGL_HINT_SWAP_INTERVAL is passed to glfwSwapInterval, default 1.
+ * CGL_HINT_FRAME_RATE caps the loop at that many frames per second,
+ * default 0 for no cap beyond the swap interval.
+ * CGL_HINT_IDLE, when non zero, skips drawing and swapping frames in
+ * which nothing changed and waits for input, a submitted batch, the next
+ * blink or the next frame at CGL_HINT_FRAME_RATE before ticking again.
+ * CGL_HINT_COLORS selects CGL_COLORS_16 (default), where cells take their
+ * colors from the attribute bits, or CGL_COLORS_256, which adds a plane of
+ * 8-bit fg and bg palette indices per cell. With CGL_COLORS_256 the
+ * attribute only contributes blink, and prints, CGLfeed and
+ * CGLblitColors write the plane.
+ * CGL_HINT_GLYPH_CACHE, when non zero, turns glyphs 128-255 into a cache
+ * of the codepoints printed with CGLwriteUTF8 or CGLglyph, so any glyph
+ * of a large font can be shown. Without it those glyphs are the font's
+ * own glyphs 128-255.
+ * CGL_HINT_VIEW_COLUMNS and CGL_HINT_VIEW_ROWS size the window in cells
+ * when the main console is larger, default 0 for the whole console. Only
+ * the cells in view are drawn, see CGLsetView.
+ * CGL_HINT_THREADS sets how many threads CGL_RENDERER_FIXED rebuilds
+ * changed cells with, default 0 for one per core.
+ * CGL_HINT_INPUT_DELAY waits that many milliseconds after each swap
+ * before reading input and ticking, default 0. With a swap interval of 1
+ * a frame that is done within the rest of the refresh still makes the
+ * next vblank and shows its input that much sooner. A swap interval of 0
+ * presents every frame as soon as it is drawn instead.
+ */
+void CGLhint(int _hint, int _value);
+
+/**
+ * Replaces the built in 8x8 CP437 font for the next call to CGLmain.
+ * Reads PSF1, PSF2 and BDF files with glyphs up to 32x32 pixels and the
+ * cell size becomes the glyph size. Cells draw glyphs 0-255 (BDF
+ * encodings 0-255); the PSF unicode table or BDF encodings give the other
+ * glyphs to CGL_HINT_GLYPH_CACHE. Pass NULL to restore the built in font.
+ * Returns NULL on success or an error message.
+ */
+const char* CGLloadFont(const char* _path);
+
 /**
  *  Opens a window
  */
 const char* CGLmain(const char* _windowTitle, int _columns, int _rows, void (*_callback)(void));
 
+/**
+ * Returns the software framebuffer, RGBA with one glyph of pixels per cell,
+ * or NULL when the software backend is not running
+ */
+const unsigned char* CGLgetFramebuffer(int* _width, int* _height);
+
+/**
+ * Writes the software framebuffer to a binary PPM file.
+ * Returns NULL on success or an error message.
+ */
+const char* CGLsaveFrame(const char* _path);
+
+/**
+ * Records the cells of the main console to a file until CGLmain returns
+ * or CGLrecord(NULL) is called. Each frame that changed anything is
+ * stored as a timestamp and the changed cell spans, run length and xor
+ * encoded, so idle or slowly changing screens cost next to nothing.
+ * Returns NULL on success or an error message.
+ */
+const char* CGLrecord(const char* _path);
+
+/**
+ * Replays a recording into the main console, which has to have the size
+ * and color mode it was recorded with. CGL_PLAY_REALTIME keeps the
+ * recorded timing, CGL_PLAY_FAST applies one recorded frame per frame,
+ * which makes a repeatable rendering benchmark. CGLplay(NULL, 0) stops.
+ * Returns NULL on success or an error message.
+ */
+const char* CGLplay(const char* _path, int _mode);
+
+/**
+ * Returns non zero while a recording is being replayed
+ */
+int CGLplaying();
+
+/**
+ * Statistics of the most recent frames, see CGLgetStats. A frame runs
+ * from the tick to the swap, waiting for the next frame is not counted.
+ * The phases are:
+ * CGL_PHASE_TICK: the tick callback, batches, playback and recording.
+ * CGL_PHASE_BLINK: the blink scan.
+ * CGL_PHASE_REBUILD: regenerating the changed cells for the renderer,
+ * rasterizing them for CGL_BACKEND_SOFTWARE, or composing them for
+ * CGL_BACKEND_TERMINAL.
+ * CGL_PHASE_UPLOAD: sending them to the GPU or writing to the terminal.
+ * CGL_PHASE_DRAW and CGL_PHASE_SWAP: issuing the draws and the swap.
+ */
+typedef struct
+{
+    int frames;                        // Frames covered, at most the last 256
+    double frameTime50;                // Frame time percentiles in seconds
+    double frameTime90;
+    double frameTime99;
+    double frameTimeMax;
+    double phaseTime[CGL_PHASE_COUNT]; // Mean seconds per frame in each phase
+    double gpuTime;                    // Mean seconds the GPU took to draw a frame, 0 without timer queries
+    double cellsChanged;               // Mean cells per frame that were changed
+    double cellsRebuilt;               // Mean cells per frame that were regenerated
+    double bytesUploaded;              // Mean bytes per frame sent to the GPU or the terminal
+    int inputEvents;                   // Input events covered, at most the last 256 taken
+    double inputLatency50;             // Input to present percentiles in seconds, see CGLpollEvent
+    double inputLatency90;
+    double inputLatency99;
+    double inputLatencyMax;
+} CGLstats;
+
+/**
+ * Fills _stats with the statistics of the most recent frames
+ */
+void CGLgetStats(CGLstats* _stats);
+
+/**
+ * Writes the phases of every frame as Chrome trace events (JSON, open it
+ * in chrome://tracing or Perfetto) to a file until CGLmain returns or
+ * CGLtrace(NULL) is called. GPU draw times, when known, and the
+ * input to present time of every event are on threads of their own.
+ * Returns NULL on success or an error message.
+ */
+const char* CGLtrace(const char* _path);
+
+/**
+ * An input event of the window
+ */
+typedef struct
+{
+    int type;      // CGL_EVENT_*
+    int key;       // GLFW key or mouse button, or the codepoint of CGL_EVENT_CHAR
+    int scancode;
+    int action;    // GLFW_PRESS, GLFW_RELEASE or GLFW_REPEAT
+    int mods;      // GLFW_MOD_* bits
+    int col;       // Cell of the window under the pointer, outside it while a button is held
+    int row;
+    double x;      // Pointer position in screen coordinates, the scroll offset or the new framebuffer size
+    double y;
+    double time;   // Seconds since CGLmain started when the event was received
+} CGLevent;
+
+/**
+ * Takes the oldest queued input event of the window. Input is read right
+ * before every tick, so a tick that takes every event first reacts to
+ * the latest input. The time from receiving each event taken in a tick
+ * to presenting that tick's frame is measured, see CGLgetStats and
+ * CGLtrace. The queue holds 256 events and drops the oldest when full.
+ * Returns non zero when _event was filled.
+ */
+int CGLpollEvent(CGLevent* _event);
+
+/**
+ * A console placed over the window. CGLmain creates the main console,
+ * more can be laid over it and every console is drawn each frame, in
+ * creation order. All other functions work on the current console.
+ */
+typedef struct CGLContext CGLContext;
+
+/**
+ * Creates a console of _columns x _rows cells placed at _col, _row of the
+ * view of the main console, which it has to fit in. Returns NULL on failure.
+ * Consoles are destroyed when CGLmain returns.
+ */
+CGLContext* CGLcreateContext(int _columns, int _rows, int _col, int _row);
+
+/**
+ * Creates a layer of _columns x _rows cells over the current console.
+ * A layer is a console of its own: make it current to draw to it with
+ * the other functions. Cells equal to _transparent, in the format of
+ * CGLblit, show what is under them. A new layer is all transparent and
+ * hidden. Layers are stacked in creation order and composited into the
+ * cells the console shows only where they or the cells under them
+ * changed, so showing, moving or hiding one costs in proportion to its
+ * area and the console never redraws what it covered. The console's own
+ * cells, as CGLread sees them, are left untouched.
+ * Returns NULL on failure or when the current console is a layer.
+ */
+CGLContext* CGLcreateLayer(int _columns, int _rows, uint16_t _transparent);
+
+/**
+ * Shows a layer with its top left cell at _col, _row of the screen of its
+ * console, or moves it there. It may lie partly outside the screen.
+ */
+void CGLshowLayer(CGLContext* _layer, int _col, int _row);
+
+/**
+ * Hides a layer, showing the cells under it again
+ */
+void CGLhideLayer(CGLContext* _layer);
+
+/**
+ * Destroys a console created with CGLcreateContext, with its layers, or a
+ * layer. The main console becomes current if the console or one of its
+ * layers was current, the layer's console if the layer was current.
+ */
+void CGLdestroyContext(CGLContext* _context);
+
+/**
+ * Makes a console current, NULL selects the main console
+ */
+void CGLmakeCurrent(CGLContext* _context);
+
+/**
+ * Returns the current console
+ */
+CGLContext* CGLgetCurrentContext();
+
+/**
+ * Scrolls the view of the main console so its top left cell shows column
+ * _col, row _row, clamped to the console. Consoles created with
+ * CGLcreateContext are placed in the view and do not move with it.
+ */
+void CGLsetView(int _col, int _row);
+
 /**
  *  Sets the default color attribute used.
  *  bits 0-3 = FG Color
@@ -23,6 +288,50 @@ void CGLsetAttrib(int _attrib);
  */
 void CGLsetAttribXY(int _attrib, int _col, int _row);
 
+/**
+ * Print _length bytes of UTF-8, which need not be terminated.
+ * ASCII is drawn with glyphs 0-127, other codepoints as with CGLglyph.
+ * Invalid sequences are drawn as '?'.
+ */
+void CGLwriteUTF8(const char * _chars, size_t _length);
+
+/**
+ * Returns the glyph that draws a codepoint, for use in cells.
+ * With CGL_HINT_GLYPH_CACHE the glyph is copied into the least recently
+ * used slot that is not on screen, and stays valid for the rest of the
+ * tick and while it is on screen. Returns '?' when the font has no glyph
+ * for the codepoint or every slot is in use.
+ * Only call it from the tick callback.
+ */
+int CGLglyph(uint32_t _codepoint);
+
+/**
+ * Sets the palette indices used by the following prints.
+ * With CGL_COLORS_16 only fg 0-15 and bg 0-7 can be shown.
+ */
+void CGLsetColors(int _fg, int _bg);
+
+/**
+ * Sets the palette indices of the cell at the specified location
+ */
+void CGLsetColorsXY(int _fg, int _bg, int _col, int _row);
+
+/**
+ * Copies a rectangle of color pairs to the screen at col, row.
+ * Pairs use bits 0-7 = fg index, bits 8-15 = bg index.
+ * _stride is the distance between source rows, in cells.
+ * CGLblit resets the colors of the cells it writes to their attribute.
+ */
+void CGLblitColors(const uint16_t* _colors, int _col, int _row, int _width, int _height, int _stride);
+
+/**
+ * Replaces _count palette entries starting at _first with RGB triples.
+ * The palette starts with the 16 console colors, then the xterm 6x6x6
+ * color cube and 24 grays. The shader renderer only uploads the palette;
+ * the fixed renderer and software backend rebuild the whole screen.
+ */
+void CGLsetPalette(int _first, int _count, const unsigned char* _rgb);
+
 /**
  * Moves the cursor to the specified location
  */
@@ -33,23 +342,150 @@ void CGLgotoXY(int _col, int _row);
  */
 void CGLprint(const char * _string);
 
+/**
+ * Print _length chars of a string, which need not be terminated.
+ * '\n' starts a new line, every other char is drawn as a glyph.
+ */
+void CGLwrite(const char * _chars, size_t _length);
+
 /**
  * Print a formatted string
  */
 void CGLprintf(const char * _format, ...);
 
+/**
+ * Feeds terminal output, such as bytes read from a pipe or pty, to the
+ * screen. Escape sequences may be split across calls.
+ * Handles CR, LF, BS, TAB, ESC D/E/M/7/8/c and the CSI sequences for
+ * cursor movement (A-G, H, f, d, s, u), erasing (J, K, X), inserting and
+ * deleting (@, P, L, M), scrolling (S, T, r) and SGR colors, bold, blink
+ * and reverse (m). SGR replaces the attribute and colors used by CGLprint.
+ * With CGL_COLORS_256, SGR 38/48;5 selects any palette entry and 38/48;2
+ * RGB colors are matched to the default palette.
+ * Other sequences and OSC strings are skipped.
+ */
+void CGLfeed(const char * _bytes, size_t _length);
+
+/**
+ * Prints a decimal integer right aligned in a field of _width chars,
+ * padded with _pad (' ' or '0')
+ */
+void CGLprintInt(long long _value, int _width, char _pad);
+
+/**
+ * Prints a fixed point number, _value / 10^_decimals, right aligned in a
+ * field of _width chars, padded with _pad (' ' or '0')
+ */
+void CGLprintFixed(long long _value, int _decimals, int _width, char _pad);
+
+/**
+ * Prints an unsigned hexadecimal number, zero padded to _width digits
+ */
+void CGLprintHex(unsigned long long _value, int _width);
+
 /**
  * Prints a single char to the screen
  */
 void CGLputc(char _char);
 
 /**
- * Prints a single char to the screen at col, row
+ * Prints a single char to the screen at col, row, keeping the attribute
+ * and colors of the cell
  */
 void CGLputcXY(char _char, int _col, int _row);
 
 /**
- * Closes the window and cleans up
+ * Copies a rectangle of cells to the screen at col, row.
+ * Cells use the screen format: bits 0-7 = char, bits 8-15 = attribute.
+ * _stride is the distance between source rows, in cells.
+ * Parts of the rectangle outside the screen are clipped.
+ */
+void CGLblit(const uint16_t* _cells, int _col, int _row, int _width, int _height, int _stride);
+
+/**
+ * Copies a rectangle of cells from the screen at col, row.
+ * Cells outside the screen are left untouched.
+ */
+void CGLread(uint16_t* _cells, int _col, int _row, int _width, int _height, int _stride);
+
+/**
+ * Fills a rectangle of the screen with one cell, in the format of CGLblit.
+ * Parts of the rectangle outside the screen are clipped.
+ */
+void CGLfillRect(uint16_t _cell, int _col, int _row, int _width, int _height);
+
+/**
+ * Sets the attribute of every cell in a rectangle of the screen, keeping
+ * their chars. Parts of the rectangle outside the screen are clipped.
+ */
+void CGLsetAttribRect(int _attrib, int _col, int _row, int _width, int _height);
+
+/**
+ * Draws the outline of a rectangle at least 2x2 cells large with the
+ * CGL_BOX_SINGLE or CGL_BOX_DOUBLE line glyphs, in the attribute and
+ * colors used by CGLprint. Loaded fonts take the glyphs from their
+ * unicode table. Parts outside the screen are clipped.
+ */
+void CGLdrawBox(int _style, int _col, int _row, int _width, int _height);
+
+/**
+ * Moves a rectangle of the screen by _dx columns and _dy rows, the
+ * source and destination may overlap. Cells of the source that are not
+ * overwritten are left as they were. Parts of either rectangle outside
+ * the screen are clipped.
+ */
+void CGLmoveRect(int _col, int _row, int _width, int _height, int _dx, int _dy);
+
+/**
+ * Scrolls the scroll region up by a number of lines, or down when negative.
+ * Scrolling the whole screen rotates the row origin instead of moving cells.
+ * Printing past the bottom of the scroll region scrolls it by one line.
+ */
+void CGLscroll(int _lines);
+
+/**
+ * Limits scrolling to rows _top to _bottom inclusive.
+ * CGLsetScrollRegion(0, rows - 1) restores the whole screen.
+ */
+void CGLsetScrollRegion(int _top, int _bottom);
+
+/**
+ * A batch of cell writes built on any thread and applied as a whole by
+ * the render thread. Every other function must only be called from the
+ * tick callback; batches are how worker threads update the screen.
+ */
+typedef struct CGLbatch CGLbatch;
+
+/**
+ * Creates an empty batch, returns NULL when out of memory
+ */
+CGLbatch* CGLbatchCreate();
+
+/**
+ * Adds a rectangle of cells to a batch, see CGLblit
+ */
+void CGLbatchBlit(CGLbatch* _batch, const uint16_t* _cells, int _col, int _row, int _width, int _height, int _stride);
+
+/**
+ * Adds a string drawn with an attribute at col, row to a batch.
+ * Control characters are drawn as glyphs.
+ */
+void CGLbatchPrintXY(CGLbatch* _batch, const char* _string, int _attrib, int _col, int _row);
+
+/**
+ * Hands a batch to the render thread without blocking. The batch is
+ * applied in full to the main console before a frame is drawn, in
+ * submission order, and is freed afterwards.
+ */
+void CGLbatchSubmit(CGLbatch* _batch);
+
+/**
+ * Frees a batch that was not submitted
+ */
+void CGLbatchDestroy(CGLbatch* _batch);
+
+/**
+ * Closes the window and cleans up once the current tick returns
  */
 void CGLshutdown();
 
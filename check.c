@@ -0,0 +1,578 @@
+// ConsoleGL headless checks
+//
+// Licensed public domain
+//
+// Runs ConsoleGL on the software backend, no window needed, and compares
+// the cells and pixels it produces with the expected ones:
+//   cc -o check check.c ConsoleGL.c -lglfw -lGL -lpthread -lm && ./check
+
+#include <stdio.h>
+#include <string.h>
+#include "ConsoleGL.h"
+
+#define CHECK(_condition) check((_condition) != 0, #_condition, __LINE__)
+
+static const char* sName;
+static int sFailures;
+static int sTicks;
+static unsigned sSeed = 1;
+static unsigned char sFrame[64 * 8 * 32 * 8 * 4];
+static unsigned long long sHashes[2][512]; // States of the main console while recording and replaying
+static int sHashCounts[2];
+static const unsigned char sPalette[] = { // The default first 16 colors
+    0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0xaa, 0x55, 0x00,
+    0x00, 0x00, 0xaa, 0xaa, 0x00, 0xaa, 0x00, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+    0x55, 0x55, 0x55, 0xff, 0x55, 0x55, 0x55, 0xff, 0x55, 0xff, 0xff, 0x55,
+    0x55, 0x55, 0xff, 0xff, 0x55, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+/**
+ * Reports a failed condition of the running check, the first few in full
+ */
+static void check(int _ok, const char* _condition, int _line)
+{
+    if (_ok) return;
+    if (sFailures++ < 20) printf("FAIL %s, line %d: %s\n", sName, _line, _condition);
+}
+
+/**
+ * Returns a pseudo random number in [0, _range)
+ */
+static int randomInt(int _range)
+{
+    sSeed = sSeed * 1103515245 + 12345;
+    return (int)((sSeed >> 8) % (unsigned)_range);
+}
+
+/**
+ * Runs a check as the tick callback of a console on the software backend
+ */
+static void run(const char* _name, void (*_tick)(void), int _columns, int _rows)
+{
+    sName = _name;
+    sTicks = 0;
+    CGLhint(CGL_HINT_BACKEND, CGL_BACKEND_SOFTWARE);
+    const char* error = CGLmain(_name, _columns, _rows, _tick);
+    if (error) check(0, error, 0);
+}
+
+/**
+ * Returns non zero when the cells of the main console equal _cells
+ */
+static int sameCells(const uint16_t* _cells, int _columns, int _rows)
+{
+    uint16_t cells[64 * 32];
+    CGLread(cells, 0, 0, _columns, _rows, _columns);
+    return memcmp(cells, _cells, _columns * _rows * sizeof(uint16_t)) == 0;
+}
+
+/**
+ * Returns non zero when a row of the main console shows _chars followed by blanks
+ */
+static int sameRow(int _row, const char* _chars, int _columns)
+{
+    uint16_t cells[64];
+    CGLread(cells, 0, _row, _columns, 1, _columns);
+    const int length = (int)strlen(_chars);
+    for (int x = 0; x < _columns; x++)
+    {
+        const int glyph = cells[x] & 255;
+        const int expected = x < length ? (unsigned char)_chars[x] : ' ';
+        if (glyph != expected && !(glyph == 0 && expected == ' ')) return 0;
+    }
+    return 1;
+}
+
+/**
+ * Returns the attribute of a cell of the main console
+ */
+static int attribAt(int _col, int _row)
+{
+    uint16_t cell = 0;
+    CGLread(&cell, _col, _row, 1, 1, 1);
+    return cell >> 8;
+}
+
+/**
+ * Returns non zero when the framebuffer drawn from the dirty spans equals a full redraw
+ */
+static int sameAsFullRedraw()
+{
+    int width, height;
+    const unsigned char* pixels = CGLgetFramebuffer(&width, &height);
+    const size_t size = (size_t)width * height * 4;
+    if (!pixels || size > sizeof(sFrame)) return 0;
+    memcpy(sFrame, pixels, size);
+
+    // Setting the palette, even to the colors it has, redraws every cell
+    CGLsetPalette(0, 16, sPalette);
+    pixels = CGLgetFramebuffer(NULL, NULL);
+    return memcmp(sFrame, pixels, size) == 0;
+}
+
+/**
+ * Writes with coordinates outside the console change nothing
+ */
+static void tickBounds(void)
+{
+    static const int outside[][2] = {{-1, 0}, {0, -1}, {16, 0}, {0, 4}, {16, -1}, {-1, 4}, {20, -1}, {-17, 1}};
+    uint16_t cells[16 * 4];
+    CGLfillRect(' ' | 0x0700, 0, 0, 16, 4);
+    CGLread(cells, 0, 0, 16, 4, 16);
+    for (size_t i = 0; i < sizeof(outside) / sizeof(outside[0]); i++)
+    {
+        CGLputcXY('x', outside[i][0], outside[i][1]);
+        CGLsetAttribXY(0x4F, outside[i][0], outside[i][1]);
+        CGLgotoXY(outside[i][0], outside[i][1]);
+    }
+    CHECK(sameCells(cells, 16, 4));
+    CHECK(CGLgetFramebuffer(NULL, NULL) != NULL);
+
+    // Inside, only the addressed cell changes
+    CGLputcXY('x', 15, 3);
+    CGLsetAttribXY(0x4F, 15, 3);
+    cells[3 * 16 + 15] = 'x' | 0x4F00;
+    CHECK(sameCells(cells, 16, 4));
+    CGLshutdown();
+}
+
+/**
+ * Scrolling regions and the whole screen, which rotates the row origin, against a model of the rows
+ */
+static void tickScroll(void)
+{
+    static uint16_t model[12][20];
+    static int top, bottom;
+    if (sTicks == 0)
+    {
+        CGLfillRect(0, 0, 0, 20, 12);
+        CGLsetScrollRegion(0, 11);
+        memset(model, 0, sizeof(model));
+        top = 0;
+        bottom = 12;
+    }
+
+    for (int op = 0; op < 4; op++)
+    {
+        const int kind = randomInt(3);
+        if (kind == 0)
+        {
+            // A third of the regions are the whole screen
+            top = randomInt(3) ? randomInt(12) : 0;
+            bottom = top ? top + 1 + randomInt(12 - top) : 12;
+            CGLsetScrollRegion(top, bottom - 1);
+        }
+        else if (kind == 1)
+        {
+            const int lines = randomInt(27) - 13;
+            const int height = bottom - top;
+            CGLscroll(lines);
+            if (lines >= height || lines <= -height)
+            {
+                memset(model[top], 0, height * sizeof(model[0]));
+            }
+            else if (lines > 0)
+            {
+                memmove(model[top], model[top + lines], (height - lines) * sizeof(model[0]));
+                memset(model[bottom - lines], 0, lines * sizeof(model[0]));
+            }
+            else if (lines < 0)
+            {
+                memmove(model[top - lines], model[top], (height + lines) * sizeof(model[0]));
+                memset(model[top], 0, -lines * sizeof(model[0]));
+            }
+        }
+        else
+        {
+            const int row = randomInt(12);
+            for (int x = 0; x < 20; x++) model[row][x] = (uint16_t)(randomInt(256) | (randomInt(2) ? 0x0F00 : 0x1E00));
+            CGLblit(model[row], 0, row, 20, 1, 20);
+        }
+    }
+    CHECK(sameCells(model[0], 20, 12));
+    CHECK(sameAsFullRedraw());
+    if (++sTicks == 300) CGLshutdown();
+}
+
+/**
+ * Writes a font of _count 8x8 glyphs without a unicode table, so codepoints are glyph numbers.
+ * Glyph g has g & 255 in its first row and 128 | g >> 8 in its second.
+ */
+static int writeFont(const char* _path, int _count)
+{
+    FILE* file = fopen(_path, "wb");
+    if (!file) return 0;
+    const unsigned char header[32] = {0x72, 0xb5, 0x4a, 0x86, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0,
+        (unsigned char)_count, (unsigned char)(_count >> 8), 0, 0, 8, 0, 0, 0, 8, 0, 0, 0, 8, 0, 0, 0};
+    fwrite(header, 1, sizeof(header), file);
+    for (int g = 0; g < _count; g++)
+    {
+        const unsigned char rows[8] = {(unsigned char)g, (unsigned char)(128 | g >> 8), 0x81, 0x42, 0x24, 0x18, 0x24, 0x42};
+        fwrite(rows, 1, sizeof(rows), file);
+    }
+    return fclose(file) == 0;
+}
+
+/**
+ * Returns the glyph of the font from writeFont that the framebuffer shows in a cell drawn white on black
+ */
+static int glyphShown(const unsigned char* _pixels, int _width, int _col, int _row)
+{
+    int rows[2] = {0, 0};
+    for (int y = 0; y < 2; y++)
+    {
+        const unsigned char* pixel = _pixels + ((size_t)(_row * 8 + y) * _width + _col * 8) * 4;
+        for (int x = 0; x < 8; x++) rows[y] |= (pixel[x * 4] != 0) << (7 - x);
+    }
+    return rows[0] | (rows[1] & 127) << 8;
+}
+
+/**
+ * Encodes a codepoint below 0x10000 as UTF-8, returns the byte count
+ */
+static int encodeUTF8(uint32_t _codepoint, char* _bytes)
+{
+    if (_codepoint < 0x80)
+    {
+        _bytes[0] = (char)_codepoint;
+        return 1;
+    }
+    if (_codepoint < 0x800)
+    {
+        _bytes[0] = (char)(0xC0 | _codepoint >> 6);
+        _bytes[1] = (char)(0x80 | (_codepoint & 63));
+        return 2;
+    }
+    _bytes[0] = (char)(0xE0 | _codepoint >> 12);
+    _bytes[1] = (char)(0x80 | ((_codepoint >> 6) & 63));
+    _bytes[2] = (char)(0x80 | (_codepoint & 63));
+    return 3;
+}
+
+/**
+ * The glyph cache evicts only slots that no console or layer shows. The main console churns through
+ * more codepoints than the cache holds while a layer, shown or hidden, keeps its own.
+ */
+static void tickCache(void)
+{
+    static CGLContext* layer;
+    static int shown[8][32];  // Codepoint each cell of the main console shows
+    static int layered[5][8]; // Codepoint of each cell of the layer
+    if (sTicks == 0)
+    {
+        CGLfillRect(' ' | 0x0F00, 0, 0, 32, 8);
+        for (int y = 0; y < 8; y++) for (int x = 0; x < 32; x++) shown[y][x] = ' ';
+        layer = CGLcreateLayer(8, 5, 0);
+        CHECK(layer != NULL);
+        if (!layer)
+        {
+            CGLshutdown();
+            return;
+        }
+        uint16_t cells[8 * 4];
+        for (int i = 0; i < 8 * 4; i++)
+        {
+            layered[i / 8][i % 8] = 1000 + i;
+            cells[i] = (uint16_t)(CGLglyph(1000 + i) | 0x0F00);
+        }
+        CGLmakeCurrent(layer);
+        CGLblit(cells, 0, 0, 8, 4, 8);
+        CGLmakeCurrent(NULL);
+        CGLshowLayer(layer, 0, 0);
+    }
+
+    // Every tenth tick rewrites part of the layer, through CGLwriteUTF8
+    if (sTicks % 10 == 5)
+    {
+        char bytes[4 * 3];
+        int length = 0;
+        for (int x = 0; x < 4; x++)
+        {
+            layered[0][x] = 1100 + sTicks / 10 * 4 + x;
+            length += encodeUTF8(layered[0][x], bytes + length);
+        }
+        CGLmakeCurrent(layer);
+        CGLfeed("\x1b[0;1;37m", 9);
+        CGLgotoXY(0, 0);
+        CGLwriteUTF8(bytes, length);
+        CGLmakeCurrent(NULL);
+    }
+
+    // The main console only changes right of the layer, and runs out of slots now and then
+    for (int i = 0; i < 24; i++)
+    {
+        const int col = 8 + randomInt(24);
+        const int row = randomInt(8);
+        const int codepoint = 2000 + randomInt(1000);
+        const int glyph = CGLglyph(codepoint);
+        shown[row][col] = glyph == '?' ? '?' : codepoint;
+        const uint16_t cell = (uint16_t)(glyph | 0x0F00);
+        CGLblit(&cell, col, row, 1, 1, 1);
+    }
+
+    // Ticks 50 to 99 and 150 to 199 hide the layer
+    if (sTicks % 100 == 50) CGLhideLayer(layer);
+    if (sTicks % 100 == 0 && sTicks) CGLshowLayer(layer, 0, 0);
+    const int visible = sTicks % 100 < 50;
+
+    // A full redraw draws every cell with the glyph its slot holds now
+    CHECK(sameAsFullRedraw());
+    int width;
+    const unsigned char* pixels = CGLgetFramebuffer(&width, NULL);
+    int wrong = 0;
+    for (int y = 0; y < 8; y++)
+    {
+        for (int x = 0; x < 32; x++)
+        {
+            const int expected = visible && x < 8 && y < 4 ? layered[y][x] : shown[y][x];
+            if (expected && glyphShown(pixels, width, x, y) != expected) wrong++;
+        }
+    }
+    CHECK(wrong == 0);
+    if (++sTicks == 200) CGLshutdown();
+}
+
+/**
+ * Appends a hash of the cells and pixels of the main console to sHashes[_pass] when they changed
+ */
+static void pushHash(int _pass, int _columns, int _rows)
+{
+    uint16_t cells[64 * 32];
+    int width, height;
+    CGLread(cells, 0, 0, _columns, _rows, _columns);
+    const unsigned char* pixels = CGLgetFramebuffer(&width, &height);
+    unsigned long long hash = 14695981039346656037ull;
+    for (int i = 0; i < _columns * _rows; i++) hash = (hash ^ cells[i]) * 1099511628211ull;
+    for (size_t i = 0; pixels && i < (size_t)width * height * 4; i++) hash = (hash ^ pixels[i]) * 1099511628211ull;
+
+    const int count = sHashCounts[_pass];
+    if (count > 0 && sHashes[_pass][count - 1] == hash) return;
+    if (count < 512) sHashes[_pass][sHashCounts[_pass]++] = hash;
+}
+
+/**
+ * Records random prints, blits, colors and scrolls, reading the framebuffer between them
+ */
+static void tickRecord(void)
+{
+    if (sTicks == 0)
+    {
+        CGLfillRect(' ' | 0x0700, 0, 0, 24, 10);
+        const char* error = CGLrecord("check.rec");
+        if (error) check(0, error, __LINE__);
+    }
+    // Stopping drops the changes of the tick it is called in, so it gets a tick of its own
+    if (sTicks == 300)
+    {
+        CGLrecord(NULL);
+        CGLshutdown();
+        return;
+    }
+
+    for (int round = 0; sTicks % 7 != 3 && round < 3; round++)
+    {
+        const int kind = randomInt(4);
+        if (kind == 0)
+        {
+            CGLscroll(randomInt(2) ? 1 : -2);
+        }
+        else if (kind == 1)
+        {
+            char bytes[64];
+            const int length = snprintf(bytes, sizeof(bytes), "\x1b[%d;%dH\x1b[38;5;%dm\x1b[4%dmrow %d\x1b[m",
+                1 + randomInt(10), 1 + randomInt(24), randomInt(256), randomInt(8), sTicks);
+            CGLfeed(bytes, length);
+        }
+        else
+        {
+            uint16_t cells[6];
+            for (int i = 0; i < 6; i++) cells[i] = (uint16_t)(randomInt(256) | randomInt(128) << 8);
+            CGLblit(cells, randomInt(24) - 3, randomInt(10), 6, 1, 6);
+        }
+        // Reading the framebuffer consumes dirty spans, the frame recorded at the end of the tick has to keep them
+        CGLgetFramebuffer(NULL, NULL);
+    }
+    pushHash(0, 24, 10);
+    sTicks++;
+}
+
+/**
+ * Replays the recording of tickRecord a frame per tick
+ */
+static void tickReplay(void)
+{
+    if (sTicks == 0)
+    {
+        const char* error = CGLplay("check.rec", CGL_PLAY_FAST);
+        if (error) check(0, error, __LINE__);
+    }
+    else
+    {
+        pushHash(1, 24, 10);
+    }
+
+    // A recording holds at most one frame per recorded tick
+    if (++sTicks > 302 || !CGLplaying())
+    {
+        CHECK(sTicks <= 302);
+        CHECK(sHashCounts[0] > 100);
+        CHECK(sHashCounts[0] == sHashCounts[1]);
+        CHECK(memcmp(sHashes[0], sHashes[1], sHashCounts[0] * sizeof(sHashes[0][0])) == 0);
+        CGLshutdown();
+    }
+}
+
+/**
+ * Overlapping and clipped moves against a model of the cells, and chars put into filled cells
+ */
+static void tickMove(void)
+{
+    static uint16_t model[10][24];
+    if (sTicks == 0)
+    {
+        for (int y = 0; y < 10; y++) for (int x = 0; x < 24; x++) model[y][x] = (uint16_t)(y * 24 + x) | 0x0700;
+        CGLblit(model[0], 0, 0, 24, 10, 24);
+    }
+
+    for (int op = 0; op < 3; op++)
+    {
+        const int col = randomInt(30) - 4;
+        const int row = randomInt(14) - 4;
+        const int width = randomInt(13);
+        const int height = randomInt(9);
+        const int dx = randomInt(13) - 6;
+        const int dy = randomInt(9) - 6;
+        CGLmoveRect(col, row, width, height, dx, dy);
+
+        uint16_t before[10][24];
+        memcpy(before, model, sizeof(model));
+        for (int y = row; y < row + height; y++)
+        {
+            for (int x = col; x < col + width; x++)
+            {
+                if (x < 0 || x >= 24 || y < 0 || y >= 10) continue;
+                if (x + dx < 0 || x + dx >= 24 || y + dy < 0 || y + dy >= 10) continue;
+                model[y + dy][x + dx] = before[y][x];
+            }
+        }
+    }
+    CHECK(sameCells(model[0], 24, 10));
+    CHECK(sameAsFullRedraw());
+
+    // A char put into a filled cell keeps the colors of the fill, (0, 0) of 'x' is background
+    CGLsetColors(14, 4);
+    CGLfillRect('#' | 0x4E00, 20, 8, 4, 2);
+    CGLputcXY('x', 21, 9);
+    int width;
+    const unsigned char* pixels = CGLgetFramebuffer(&width, NULL);
+    const unsigned char* fill = pixels + ((size_t)(9 * 8) * width + 20 * 8) * 4;
+    const unsigned char* put = pixels + ((size_t)(9 * 8) * width + 21 * 8) * 4;
+    CHECK(memcmp(fill, put, 4) == 0 && (fill[0] || fill[1] || fill[2]));
+    for (int y = 8; y < 10; y++) for (int x = 20; x < 24; x++) model[y][x] = '#' | 0x4E00;
+    model[9][21] = 'x' | 0x4E00;
+
+    if (++sTicks == 300) CGLshutdown();
+}
+
+/**
+ * Feeds terminal output whole, or a byte at a time to split every sequence
+ */
+static void feed(const char* _bytes, int _split)
+{
+    const size_t length = strlen(_bytes);
+    if (!_split) CGLfeed(_bytes, length);
+    for (size_t i = 0; _split && i < length; i++) CGLfeed(_bytes + i, 1);
+    CHECK(sameAsFullRedraw());
+}
+
+/**
+ * Printing, cursor movement, erasing, inserting, deleting, scrolling and SGR through CGLfeed
+ */
+static void tickFeed(void)
+{
+    const char* reset = "\x1b[m\x1b[r\x1b[2J\x1b[H";
+    const int split = sTicks;
+
+    feed(reset, split);
+    feed("\x1b]0;title\x07hello\r\nworld\x1b[1;31mRED\x1b[0m!", split);
+    CHECK(sameRow(0, "hello", 20));
+    CHECK(sameRow(1, "worldRED!", 20));
+    CHECK(attribAt(0, 0) == 0x07 && attribAt(5, 1) == 0x09 && attribAt(8, 1) == 0x07);
+
+    feed(reset, split);
+    feed("\x1b[3;5Hab\x1b[3;6H\x1b[K\x1b[4;1H\x1b[44;5mX\x1b[m", split);
+    CHECK(sameRow(2, "    a", 20));
+    CHECK(sameRow(3, "X", 20));
+    CHECK(attribAt(0, 3) == 0xC7);
+
+    feed(reset, split);
+    feed("\x1b[4;1Habcdef\x1b[4;3H\x1b[2P\x1b[4;1H\x1b[1@", split);
+    CHECK(sameRow(3, " abef", 20));
+
+    // LF at the bottom of the region scrolls only the region, L pushes rows off the bottom
+    feed(reset, split);
+    feed("1\r\n2\r\n3\r\n4\r\n5\x1b[2;4r\x1b[4;1H\n\n\x1b[r\x1b[1;1H\x1b[2L", split);
+    CHECK(sameRow(0, "", 20) && sameRow(1, "", 20));
+    CHECK(sameRow(2, "1", 20) && sameRow(3, "4", 20));
+    CHECK(sameRow(4, "", 20) && sameRow(5, "", 20));
+
+    // Printing past the last column of the last row wraps and scrolls
+    feed(reset, split);
+    feed("\x1b[6;1H12345678901234567890AB", split);
+    CHECK(sameRow(4, "12345678901234567890", 20));
+    CHECK(sameRow(5, "AB", 20));
+
+    feed(reset, split);
+    feed("\tx\bY\x1b[2;3H\x1b" "7\x1b[5;10Hq\x1b" "8p", split);
+    CHECK(sameRow(0, "        Y", 20));
+    CHECK(sameRow(1, "  p", 20));
+    CHECK(sameRow(4, "         q", 20));
+
+    if (++sTicks == 2) CGLshutdown();
+}
+
+int main()
+{
+    run("bounds", tickBounds, 16, 4);
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_256);
+    run("bounds 256", tickBounds, 16, 4);
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_16);
+    run("scroll", tickScroll, 20, 12);
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_256);
+    run("scroll 256", tickScroll, 20, 12);
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_16);
+    run("feed", tickFeed, 20, 6);
+    run("move", tickMove, 24, 10);
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_256);
+    run("move 256", tickMove, 24, 10);
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_16);
+
+    if (!writeFont("check_font.psf", 4096) || CGLloadFont("check_font.psf"))
+    {
+        check(0, "cannot write or load check_font.psf", 0);
+    }
+    else
+    {
+        CGLhint(CGL_HINT_GLYPH_CACHE, 1);
+        run("cache", tickCache, 32, 8);
+        CGLhint(CGL_HINT_COLORS, CGL_COLORS_256);
+        run("cache 256", tickCache, 32, 8);
+        CGLhint(CGL_HINT_COLORS, CGL_COLORS_16);
+        CGLhint(CGL_HINT_GLYPH_CACHE, 0);
+        CGLloadFont(NULL);
+    }
+    remove("check_font.psf");
+
+    for (int colors = CGL_COLORS_16; colors <= CGL_COLORS_256; colors++)
+    {
+        sHashCounts[0] = sHashCounts[1] = 0;
+        CGLhint(CGL_HINT_COLORS, colors);
+        run(colors == CGL_COLORS_16 ? "record" : "record 256", tickRecord, 24, 10);
+        run(colors == CGL_COLORS_16 ? "replay" : "replay 256", tickReplay, 24, 10);
+    }
+    CGLhint(CGL_HINT_COLORS, CGL_COLORS_16);
+    remove("check.rec");
+
+    printf("%d failures\n", sFailures);
+    return sFailures != 0;
+}
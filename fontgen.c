@@ -0,0 +1,29 @@
+// ConsoleGL font atlas generator
+//
+// Licensed public domain
+//
+// Expands font.h into the 128x128 alpha atlas uploaded at startup:
+//   cc -o fontgen fontgen.c && ./fontgen > font_atlas.h
+
+#include <stdio.h>
+#include "font.h"
+
+int main()
+{
+    printf("// Generated by fontgen.c from font.h, do not edit\n\n");
+    printf("// 16x16 glyphs of 8x8 texels, one alpha byte per texel\n");
+    printf("const unsigned char font_atlas[128 * 128] = {\n");
+    for (int y = 0; y < 128; y++)
+    {
+        printf("    ");
+        for (int x = 0; x < 128; x++)
+        {
+            const int glyph = (y / 8) * 16 + x / 8;
+            const unsigned char row = font_data[glyph * 8 + y % 8];
+            printf("%d,", ((row >> (7 - x % 8)) & 1) * 255);
+        }
+        printf("\n");
+    }
+    printf("};\n");
+    return 0;
+}